@@ -64,6 +64,10 @@ class ArithmeticCoder : impl::RangeSaveBase {
 
   FinalRet finalize() &&;
 
+ private:
+  template <class RC>
+  typename RC::Range renormalize_(typename RC::Range rng);
+
  private:
   std::unique_ptr<ByteDataConstructor> dataConstructor_;
   std::size_t bitsEncoded_{0};
@@ -89,30 +93,17 @@ ArithmeticCoder&& ArithmeticCoder::encode(const OrdFlow& ordFlow, DictT& dict) {
 template <std::ranges::input_range OrdFlow, class DictT>
 ArithmeticCoder&& ArithmeticCoder::encode(const OrdFlow& ordFlow, DictT& dict,
                                           auto tick) {
-  using RC = impl::RangesCalc<typename DictT::Count, DictT::countNumBits>;
+  using RC = impl::RangesCalc<typename DictT::Count, DictT::countNumBits,
+                              impl::rangesCalcModeOf<DictT>>;
   auto currRange = calcRange_<RC>();
 
   for (auto ord : ordFlow) {
+    const auto totalLog2 = impl::getTotalWordsCntLog2(dict);
     const auto [low, high, total] = dict.getProbabilityStats(ord);
-    currRange = RC::rangeFromStatsAndPrev(currRange, {low, high, total});
+    const auto scaled = RC::scaleRange(currRange, total, totalLog2);
+    currRange = RC::rangeFromScaledAndStats(scaled, {low, high, total});
 
-    while (true) {
-      if (currRange.high <= RC::half) {
-        bitsEncoded_ += btf_ + 1;
-        dataConstructor_->putBit(false);
-        dataConstructor_->putBitsRepeatWithReset(true, btf_);
-      } else if (currRange.low >= RC::half) {
-        bitsEncoded_ += btf_ + 1;
-        dataConstructor_->putBit(true);
-        dataConstructor_->putBitsRepeatWithReset(false, btf_);
-      } else if (currRange.low >= RC::quarter &&
-                 currRange.high <= RC::threeQuarters) {
-        ++btf_;
-      } else {
-        break;
-      }
-      currRange = RC::recalcRange(currRange);
-    }
+    currRange = renormalize_<RC>(currRange);
     ++wordsCnt_;
     tick();
   }
@@ -124,6 +115,41 @@ ArithmeticCoder&& ArithmeticCoder::encode(const OrdFlow& ordFlow, DictT& dict,
   return std::move(*this);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+template <class RC>
+auto ArithmeticCoder::renormalize_(typename RC::Range rng) -> RC::Range {
+  if constexpr (RC::bulkRenorm) {
+    // Emit all settled leading bits at once, then count middle expansions.
+    if (const auto settled = RC::countSettledBits(rng); settled != 0) {
+      const auto prefix =
+          static_cast<std::uint64_t>(rng.low >> (RC::numBits - settled));
+      bitsEncoded_ += btf_ + settled;
+      dataConstructor_->putBitThenRepeatOppositeWithReset(
+          ((prefix >> (settled - 1)) & 1) != 0, btf_);
+      dataConstructor_->putBits(prefix, settled - 1);
+      rng = RC::shiftSettled(rng, settled);
+    }
+    const auto follow = RC::countFollowBits(rng);
+    btf_ += follow;
+    return RC::shiftFollow(rng, follow);
+  } else {
+    while (true) {
+      if (rng.high <= RC::half) {
+        bitsEncoded_ += btf_ + 1;
+        dataConstructor_->putBitThenRepeatOppositeWithReset(false, btf_);
+      } else if (rng.low >= RC::half) {
+        bitsEncoded_ += btf_ + 1;
+        dataConstructor_->putBitThenRepeatOppositeWithReset(true, btf_);
+      } else if (rng.low >= RC::quarter && rng.high <= RC::threeQuarters) {
+        ++btf_;
+      } else {
+        return rng;
+      }
+      rng = RC::recalcRange(rng);
+    }
+  }
+}
+
 }  // namespace ael
 
 #endif  // AEL_ARITHMETIC_CODER_HPP
@@ -15,9 +15,6 @@ namespace ael {
 /// \brief The ArithmeticCoderEncoded class
 ///
 class ByteDataConstructor {
- private:
-  constexpr static auto startMask_ = std::byte{0b10000000};
-
  public:
   ////////////////////////////////////////////////////////////////////////////
   /// \brief The ByteBackInserter class
@@ -46,6 +43,14 @@ class ByteDataConstructor {
    */
   void putBit(bool bit);
 
+  /**
+   * @brief putBits - add `num` lowest bits of `bits` in the end, most
+   * significant first.
+   * @param bits - bits to put.
+   * @param num - number of bits to put (not more than 64).
+   */
+  void putBits(std::uint64_t bits, std::size_t num);
+
   /**
    * @brief putBitsRepeat
    * @param bit - bit which is set
@@ -60,6 +65,14 @@ class ByteDataConstructor {
    */
   void putBitsRepeatWithReset(bool bit, std::size_t& num);
 
+  /**
+   * @brief putBitThenRepeatOppositeWithReset - put bit followed by `num`
+   * opposite bits and set `num` to zero.
+   * @param bit - first bit.
+   * @param num - number of opposite bits after the first one.
+   */
+  void putBitThenRepeatOppositeWithReset(bool bit, std::size_t& num);
+
   /**
    * @brief putByte - add byte in the end
    * @param byteToPut - byte
@@ -129,11 +142,10 @@ class ByteDataConstructor {
   using TBytes = std::array<std::byte, sizeof(T)>;
 
  private:
-  void moveBitFlag_();
+  void putBitsAligned_(std::uint64_t bits, std::size_t num);
 
  private:
   std::vector<std::byte> data_{};
-  std::byte currBitFlag_{startMask_};
   std::uint8_t currBitOffset_{0};
 };
 
@@ -223,8 +235,8 @@ void ByteDataConstructor::putTToPosition(auto element, std::size_t position) {
 ////////////////////////////////////////////////////////////////////////////////
 template <class T>
 std::size_t ByteDataConstructor::saveSpaceForT() {
-  if (currBitFlag_ != startMask_) {
-    throw BytesAfterBits("Tried saving bytes with bit flag != 0b10000000.");
+  if (currBitOffset_ != 0) {
+    throw BytesAfterBits("Tried saving bytes with bit offset != 0.");
   }
   const auto ret = data_.size();
   data_.resize(data_.size() + sizeof(T));
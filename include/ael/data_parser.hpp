@@ -3,6 +3,7 @@
 
 #include <ael/impl/byte_rng_to_bits.hpp>
 #include <array>
+#include <climits>
 #include <cstddef>
 #include <cstdint>
 #include <span>
@@ -13,6 +14,10 @@ namespace ael {
 /// \brief The DataParser class
 ///
 class DataParser {
+ public:
+  /// Maximal number of bits which can be peeked or taken at once.
+  constexpr static std::size_t maxBitsAtOnce = 56;
+
  public:
   /**
    * @brief DataParser move constructor.
@@ -38,6 +43,28 @@ class DataParser {
    */
   bool takeBit();
 
+  /**
+   * @brief peekBits get `num` bits from current position without moving.
+   * Bits after the end of data are read as zeros.
+   * @param num - number of bits (not more than `maxBitsAtOnce`).
+   * @return bits with the first one in the most significant position.
+   */
+  std::uint64_t peekBits(std::size_t num);
+
+  /**
+   * @brief takeBits get `num` bits from current position and move by `num`
+   * bits. Bits after the end of data are read as zeros.
+   * @param num - number of bits (not more than `maxBitsAtOnce`).
+   * @return bits with the first one in the most significant position.
+   */
+  std::uint64_t takeBits(std::size_t num);
+
+  /**
+   * @brief skipBits move by `num` bits.
+   * @param num - number of bits to skip.
+   */
+  void skipBits(std::size_t num);
+
   /**
    * @brief takeT get T as sizeof(T) bits.
    * @return object of type T.
@@ -90,7 +117,11 @@ class DataParser {
   ~DataParser() = default;
 
  private:
-  void moveInByteOffset_();
+  void refill_();
+
+  [[nodiscard]] std::size_t getBitsOffset_() const {
+    return nextByteIdx_ * CHAR_BIT - bufferedBitsCnt_;
+  }
 
  private:
   using BitsView = decltype(impl::to_bits(
@@ -99,8 +130,9 @@ class DataParser {
  private:
   const std::span<const std::byte> data_;
   BitsView bitsView_;
-  std::span<const std::byte>::iterator dataIter_;
-  std::uint8_t inByteOffset_{};
+  std::uint64_t bitsBuffer_{};
+  std::size_t bufferedBitsCnt_{};
+  std::size_t nextByteIdx_{};
 
  private:
   friend bool operator==(const DataParser& dp1, const DataParser& dp2);
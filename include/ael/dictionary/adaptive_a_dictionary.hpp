@@ -4,8 +4,10 @@
 #include <ael/impl/dictionary/a_d_dictionary_base.hpp>
 #include <ael/impl/dictionary/contextual_dictionary_base_improved.hpp>
 #include <ael/impl/dictionary/contextual_dictionary_base.hpp>
+#include <ael/impl/dictionary/decoded_word.hpp>
 #include <ael/impl/dictionary/word_probability_stats.hpp>
 #include <cstdint>
+#include <memory_resource>
 
 namespace ael::dict {
 
@@ -17,14 +19,24 @@ class AdaptiveADictionary : protected ael::impl::dict::ADDictionaryBase {
   using Ord = std::uint64_t;
   using Count = std::uint64_t;
   using ProbabilityStats = ael::impl::dict::WordProbabilityStats<Count>;
+  using DecodedWord = ael::impl::dict::DecodedWord<Count>;
   constexpr const static std::uint16_t countNumBits = 62;
 
  public:
   /**
    * Adaptive <<A>> dictionary constructor.
    * @param maxOrd - maximal order.
+   * @param layout - counts storage layout.
+   * @param rescaleThreshold - real total words count, exceeding which
+   * halves real counts of all words.
+   * @param resource - memory resource of counts storage.
    */
-  explicit AdaptiveADictionary(Ord maxOrd);
+  explicit AdaptiveADictionary(
+      Ord maxOrd,
+      ael::impl::dict::CountsLayout layout =
+          ael::impl::dict::CountsLayout::automatic,
+      Count rescaleThreshold = ael::impl::dict::noRescale,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
   /**
    * @brief getWordOrd - get word order index by cumulative count.
@@ -40,6 +52,14 @@ class AdaptiveADictionary : protected ael::impl::dict::ADDictionaryBase {
    */
   [[nodiscard]] ProbabilityStats getProbabilityStats(Ord ord);
 
+  /**
+   * @brief decodeSymbol - find a word by cumulative count, get its
+   * probability stats and update, in a single search.
+   * @param cumulativeCnt - search key.
+   * @return [ord, low, high, total]
+   */
+  [[nodiscard]] DecodedWord decodeSymbol(Count cumulativeCnt);
+
   /**
    * @brief totalWordsCount - get total words count estimation.
    * @return total words count estimation
@@ -49,10 +69,15 @@ class AdaptiveADictionary : protected ael::impl::dict::ADDictionaryBase {
  protected:
   [[nodiscard]] Count getLowerCumulativeCnt_(Ord ord) const;
 
+  [[nodiscard]] Count calcLowerCumulativeCnt_(Ord ord, Count realLowerCnt,
+                                              Count uniqueLowerCnt) const;
+
   [[nodiscard]] Count getWordCnt_(Ord ord) const;
 
   [[nodiscard]] ProbabilityStats getProbabilityStats_(Ord ord) const;
 
+  [[nodiscard]] DecodedWord findWord_(Count cumulativeCnt) const;
+
  private:
   friend class ael::impl::dict::ContextualDictionaryStatsBase<
       AdaptiveADictionary>;
@@ -4,8 +4,10 @@
 #include <ael/impl/dictionary/a_d_dictionary_base.hpp>
 #include <ael/impl/dictionary/contextual_dictionary_base_improved.hpp>
 #include <ael/impl/dictionary/contextual_dictionary_base.hpp>
+#include <ael/impl/dictionary/decoded_word.hpp>
 #include <ael/impl/dictionary/word_probability_stats.hpp>
 #include <cstdint>
+#include <memory_resource>
 
 namespace ael::dict {
 
@@ -17,6 +19,7 @@ class AdaptiveDDictionary : protected ael::impl::dict::ADDictionaryBase {
   using Ord = std::uint64_t;
   using Count = std::uint64_t;
   using ProbabilityStats = ael::impl::dict::WordProbabilityStats<Count>;
+  using DecodedWord = ael::impl::dict::DecodedWord<Count>;
   constexpr const static std::uint16_t countNumBits = 62;
 
  public:
@@ -25,8 +28,17 @@ class AdaptiveDDictionary : protected ael::impl::dict::ADDictionaryBase {
   /**
    * Adaptive <<D>> dictionary constructor.
    * @param maxOrd - maximal order.
+   * @param layout - counts storage layout.
+   * @param rescaleThreshold - real total words count, exceeding which
+   * halves real counts of all words.
+   * @param resource - memory resource of counts storage.
    */
-  explicit AdaptiveDDictionary(Ord maxOrd);
+  explicit AdaptiveDDictionary(
+      Ord maxOrd,
+      ael::impl::dict::CountsLayout layout =
+          ael::impl::dict::CountsLayout::automatic,
+      Count rescaleThreshold = ael::impl::dict::noRescale,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
   /**
    * @brief getWord - get word by cumulative num found.
@@ -42,6 +54,14 @@ class AdaptiveDDictionary : protected ael::impl::dict::ADDictionaryBase {
    */
   [[nodiscard]] ProbabilityStats getProbabilityStats(Ord ord);
 
+  /**
+   * @brief decodeSymbol - find a word by cumulative count, get its
+   * probability stats and update, in a single search.
+   * @param cumulativeCnt - search key.
+   * @return [ord, low, high, total]
+   */
+  [[nodiscard]] DecodedWord decodeSymbol(Count cumulativeCnt);
+
   /**
    * @brief totalWordsCount
    * @return
@@ -51,10 +71,15 @@ class AdaptiveDDictionary : protected ael::impl::dict::ADDictionaryBase {
  protected:
   [[nodiscard]] Count getLowerCumulativeCnt_(Ord ord) const;
 
+  [[nodiscard]] Count calcLowerCumulativeCnt_(Ord ord, Count realLowerCnt,
+                                              Count uniqueLowerCnt) const;
+
   [[nodiscard]] Count getWordCnt_(Ord ord) const;
 
   [[nodiscard]] ProbabilityStats getProbabilityStats_(Ord ord) const;
 
+  [[nodiscard]] DecodedWord findWord_(Count cumulativeCnt) const;
+
  private:
   friend class ael::impl::dict::ContextualDictionaryStatsBase<
       AdaptiveDDictionary>;
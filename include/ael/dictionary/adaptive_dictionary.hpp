@@ -2,6 +2,7 @@
 #define AEL_DICT_ADAPTIVE_DICTIONARY_HPP
 
 #include <ael/impl/dictionary/adaptive_dictionary_base.hpp>
+#include <ael/impl/dictionary/counts_options.hpp>
 #include <ael/impl/dictionary/word_probability_stats.hpp>
 #include <cstdint>
 
@@ -24,6 +25,9 @@ class AdaptiveDictionary
   struct ConstructInfo {
     Ord maxOrd{2};
     std::uint64_t ratio{4};
+    /// Real total words count, exceeding which halves real counts of all
+    /// words.
+    Count rescaleThreshold{ael::impl::dict::noRescale};
   };
 
  public:
@@ -31,7 +35,7 @@ class AdaptiveDictionary
 
   /**
    * @brief AdaptiveDictionary constructor.
-   * @param constructInfo - maximal order and ratio.
+   * @param constructInfo - maximal order, ratio and rescale threshold.
    */
   explicit AdaptiveDictionary(ConstructInfo constructInfo);
 
@@ -76,7 +76,6 @@ DecreasingOnUpdateDictionary::DecreasingOnUpdateDictionary(
       maxOrd_(maxOrd) {
   for (const auto& [ord, count] : countRng) {
     changeRealWordCnt_(ord, count);
-    changeRealCumulativeWordCnt_(ord, count);
     changeRealTotalWordsCnt_(count);
   }
 }
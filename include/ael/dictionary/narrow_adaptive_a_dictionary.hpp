@@ -0,0 +1,16 @@
+#ifndef AEL_DICT_NARROW_ADAPTIVE_A_DICTIONARY_HPP
+#define AEL_DICT_NARROW_ADAPTIVE_A_DICTIONARY_HPP
+
+#include <ael/dictionary/adaptive_a_dictionary.hpp>
+#include <ael/impl/dictionary/narrow_a_d_dictionary_base.hpp>
+
+namespace ael::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The adaptive A dictionary with 32-bit counts for small alphabets.
+using NarrowAdaptiveADictionary =
+    ael::impl::dict::NarrowADDictionaryBase<AdaptiveADictionary>;
+
+}  // namespace ael::dict
+
+#endif  // AEL_DICT_NARROW_ADAPTIVE_A_DICTIONARY_HPP
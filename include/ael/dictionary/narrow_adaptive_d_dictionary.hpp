@@ -0,0 +1,16 @@
+#ifndef AEL_DICT_NARROW_ADAPTIVE_D_DICTIONARY_HPP
+#define AEL_DICT_NARROW_ADAPTIVE_D_DICTIONARY_HPP
+
+#include <ael/dictionary/adaptive_d_dictionary.hpp>
+#include <ael/impl/dictionary/narrow_a_d_dictionary_base.hpp>
+
+namespace ael::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The adaptive D dictionary with 32-bit counts for small alphabets.
+using NarrowAdaptiveDDictionary =
+    ael::impl::dict::NarrowADDictionaryBase<AdaptiveDDictionary>;
+
+}  // namespace ael::dict
+
+#endif  // AEL_DICT_NARROW_ADAPTIVE_D_DICTIONARY_HPP
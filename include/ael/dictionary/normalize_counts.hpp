@@ -0,0 +1,31 @@
+#ifndef AEL_DICT_NORMALIZE_COUNTS_HPP
+#define AEL_DICT_NORMALIZE_COUNTS_HPP
+
+#include <cstdint>
+#include <map>
+
+namespace ael::dict {
+
+/**
+ * @brief normalizeCounts - quantize word counts to a power of two total.
+ *
+ * Every word with a nonzero count keeps a nonzero count. Counts are
+ * chosen to keep code length of the original histogram (KL divergence)
+ * close to the least. Result is meant for StaticDictionary:
+ * a power of two total lets coders replace a division with a shift, and a
+ * small total makes StaticDictionary decode by a lookup table.
+ *
+ * @param countsMapping - word counts.
+ * @param totalLog2 - binary logarithm of the total of result counts.
+ * @return normalized word counts, which sum is `2^totalLog2`.
+ * @throws std::invalid_argument if there are no nonzero counts, there are
+ * more words with nonzero counts than the total, or `totalLog2` is greater
+ * than StaticDictionary::countNumBits.
+ */
+[[nodiscard]] std::map<std::uint64_t, std::uint64_t> normalizeCounts(
+    const std::map<std::uint64_t, std::uint64_t>& countsMapping,
+    std::uint16_t totalLog2);
+
+}  // namespace ael::dict
+
+#endif  // AEL_DICT_NORMALIZE_COUNTS_HPP
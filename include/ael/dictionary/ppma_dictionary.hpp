@@ -1,14 +1,14 @@
 #ifndef AEL_DICT_PPMA_DICTIONARY_HPP
 #define AEL_DICT_PPMA_DICTIONARY_HPP
 
-#include <ael/impl/dictionary/cumulative_count.hpp>
-#include <ael/impl/dictionary/cumulative_unique_count.hpp>
+#include <ael/impl/dictionary/compact_cumulative_count.hpp>
+#include <ael/impl/dictionary/counts_options.hpp>
+#include <ael/impl/dictionary/ctx_tree.hpp>
+#include <ael/impl/dictionary/decoded_word.hpp>
 #include <ael/impl/dictionary/ppm_a_d_dictionary_base.hpp>
 #include <ael/impl/dictionary/word_probability_stats.hpp>
-#include <boost/container_hash/hash.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
 #include <cstdint>
-#include <unordered_map>
 
 namespace ael::dict {
 
@@ -27,6 +27,7 @@ class PPMADictionary
   using Ord = Base_::Ord;
   using Count = boost::multiprecision::uint256_t;
   using ProbabilityStats = ael::impl::dict::WordProbabilityStats<Count>;
+  using DecodedWord = ael::impl::dict::DecodedWord<Count>;
   constexpr const static std::uint16_t countNumBits = 240;
 
   ////////////////////////////////////////////////////////////////////////////
@@ -35,6 +36,16 @@ class PPMADictionary
   struct ConstructInfo {
     Ord maxOrd{2};
     std::size_t ctxLength{0};
+    /// Total words count of a context, exceeding which halves all counts of
+    /// this context.
+    std::uint64_t rescaleThreshold{ael::impl::dict::noRescale};
+    /// Maximal number of contexts, which bounds model memory. Each context
+    /// keeps counts of words met in it, inline for a few words and sparse
+    /// for more.
+    std::size_t maxCtxsCnt{ael::impl::dict::noCtxsLimit};
+    /// What to do, when contexts limit is reached.
+    ael::impl::dict::CtxsLimitPolicy ctxsLimitPolicy{
+        ael::impl::dict::CtxsLimitPolicy::restart};
   };
 
  private:
@@ -44,7 +55,8 @@ class PPMADictionary
   /**
    * @brief PPMA dictionary constructor.
    *
-   * @param constructInfo - maximal order and context length.
+   * @param constructInfo - maximal order, context length and rescale
+   * threshold.
    */
   explicit PPMADictionary(ConstructInfo constructInfo);
 
@@ -64,6 +76,14 @@ class PPMADictionary
    */
   [[nodiscard]] ProbabilityStats getProbabilityStats(Ord ord);
 
+  /**
+   * @brief decodeSymbol - find a word by cumulative count, get its
+   * probability stats and update, in a single search.
+   * @param cumulativeNumFound - search key.
+   * @return [ord, low, high, total]
+   */
+  [[nodiscard]] DecodedWord decodeSymbol(const Count& cumulativeNumFound);
+
   /**
    * @brief getTotalWordsCount - get total words count estimation.
    *
@@ -73,10 +93,8 @@ class PPMADictionary
 
  private:
   using SearchCtx_ = Base_::SearchCtx_;
-  using SearchCtxHash_ = boost::hash<SearchCtx_>;
   using CtxCountMapping_ =
-      std::unordered_map<SearchCtx_, ael::impl::dict::CumulativeCount,
-                         SearchCtxHash_>;
+      ael::impl::dict::CtxTree<ael::impl::dict::CompactCumulativeCount>;
 
  private:
   [[nodiscard]] Count getLowerCumulativeCnt_(Ord ord) const;
@@ -86,8 +104,7 @@ class PPMADictionary
   void updateWordCnt_(Ord ord, std::int64_t cnt);
 
  private:
-  ael::impl::dict::CumulativeCount zeroCtxCnt_;
-  ael::impl::dict::CumulativeUniqueCount zeroCtxUniqueCnt_;
+  ael::impl::dict::CompactCumulativeCount zeroCtxCnt_;
   CtxCountMapping_ ctxInfo_;
 
  private:
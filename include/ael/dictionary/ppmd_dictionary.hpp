@@ -1,15 +1,15 @@
 #ifndef AEL_DICT_PPMD_DICTIONARY_HPP
 #define AEL_DICT_PPMD_DICTIONARY_HPP
 
-#include <ael/impl/dictionary/cumulative_count.hpp>
-#include <ael/impl/dictionary/cumulative_unique_count.hpp>
+#include <ael/impl/dictionary/compact_cumulative_count.hpp>
+#include <ael/impl/dictionary/counts_options.hpp>
+#include <ael/impl/dictionary/ctx_tree.hpp>
+#include <ael/impl/dictionary/decoded_word.hpp>
 #include <ael/impl/dictionary/ppm_a_d_dictionary_base.hpp>
 #include <ael/impl/dictionary/word_probability_stats.hpp>
-#include <boost/container_hash/hash.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
 #include <cstddef>
 #include <cstdint>
-#include <unordered_map>
 
 namespace ael::dict {
 
@@ -23,13 +23,12 @@ class PPMDDictionary
  protected:
   using Base_ =
       ael::impl::dict::PPMADDictionaryBase<PPMDDictionary, ppmdMaxCtxLength>;
-  using CumulativeCount_ = ael::impl::dict::CumulativeCount;
-  using CumulativeUniqueCount_ = ael::impl::dict::CumulativeUniqueCount;
 
  public:
   using Ord = Base_::Ord;
   using Count = boost::multiprecision::uint256_t;
   using ProbabilityStats = ael::impl::dict::WordProbabilityStats<Count>;
+  using DecodedWord = ael::impl::dict::DecodedWord<Count>;
   constexpr const static std::uint16_t countNumBits = 240;
 
   ////////////////////////////////////////////////////////////////////////////
@@ -38,6 +37,16 @@ class PPMDDictionary
   struct ConstructInfo {
     Ord maxOrd{2};
     std::size_t ctxLength{0};
+    /// Total words count of a context, exceeding which halves all counts of
+    /// this context.
+    std::uint64_t rescaleThreshold{ael::impl::dict::noRescale};
+    /// Maximal number of contexts, which bounds model memory. Each context
+    /// keeps counts of words met in it, inline for a few words and sparse
+    /// for more.
+    std::size_t maxCtxsCnt{ael::impl::dict::noCtxsLimit};
+    /// What to do, when contexts limit is reached.
+    ael::impl::dict::CtxsLimitPolicy ctxsLimitPolicy{
+        ael::impl::dict::CtxsLimitPolicy::restart};
   };
 
  private:
@@ -46,7 +55,8 @@ class PPMDDictionary
  public:
   /**
    * PPMD dictionary constructor.
-   * @param maxOrd - maximal order and context length.
+   * @param constructInfo - maximal order, context length and rescale
+   * threshold.
    */
   explicit PPMDDictionary(ConstructInfo constructInfo);
 
@@ -64,6 +74,14 @@ class PPMDDictionary
    */
   [[nodiscard]] ProbabilityStats getProbabilityStats(Ord ord);
 
+  /**
+   * @brief decodeSymbol - find a word by cumulative count, get its
+   * probability stats and update, in a single search.
+   * @param cumulativeNumFound - search key.
+   * @return [ord, low, high, total]
+   */
+  [[nodiscard]] DecodedWord decodeSymbol(const Count& cumulativeNumFound);
+
   /**
    * @brief getTotalWordsCount - get total words count estimation.
    * @return total words count estimation
@@ -72,15 +90,8 @@ class PPMDDictionary
 
  private:
   using SearchCtx_ = Base_::SearchCtx_;
-  using SearchCtxHash_ = boost::hash<SearchCtx_>;
-  struct CtxCell_ {
-    explicit CtxCell_(Ord maxOrd) : cnt(maxOrd), uniqueCnt(maxOrd) {
-    }
-    CumulativeCount_ cnt;
-    CumulativeUniqueCount_ uniqueCnt;
-  };
-  using CtxCountMapping_ =
-      std::unordered_map<SearchCtx_, CtxCell_, SearchCtxHash_>;
+  using CtxCell_ = ael::impl::dict::CompactCumulativeCount;
+  using CtxCountMapping_ = ael::impl::dict::CtxTree<CtxCell_>;
 
  private:
   [[nodiscard]] Count getLowerCumulativeCnt_(Ord ord) const;
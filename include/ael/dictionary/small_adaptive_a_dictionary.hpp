@@ -0,0 +1,54 @@
+#ifndef AEL_DICT_SMALL_ADAPTIVE_A_DICTIONARY_HPP
+#define AEL_DICT_SMALL_ADAPTIVE_A_DICTIONARY_HPP
+
+#include <ael/impl/dictionary/counts_options.hpp>
+#include <ael/impl/dictionary/small_adaptive_dictionary_base.hpp>
+#include <cstdint>
+
+namespace ael::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The SmallAdaptiveADictionary class
+///
+/// Adaptive <<A>> dictionary for alphabets, which size is known at compile
+/// time and is small (bytes, nibbles). Same model as AdaptiveADictionary.
+///
+template <std::uint64_t maxOrd>
+class SmallAdaptiveADictionary
+    : public ael::impl::dict::SmallAdaptiveDictionaryBase<
+          maxOrd, SmallAdaptiveADictionary<maxOrd>> {
+ public:
+  using Ord = std::uint64_t;
+  using Count = std::uint64_t;
+
+ public:
+  /**
+   * @brief SmallAdaptiveADictionary constructor.
+   * @param rescaleThreshold - real total words count, exceeding which halves
+   * real counts of all words.
+   */
+  explicit SmallAdaptiveADictionary(
+      Count rescaleThreshold = ael::impl::dict::noRescale)
+      : ael::impl::dict::SmallAdaptiveDictionaryBase<
+            maxOrd, SmallAdaptiveADictionary<maxOrd>>(rescaleThreshold) {
+    this->recalcLowerCnts_();
+  }
+
+ private:
+  [[nodiscard]] ael::impl::dict::LowerCntCoefs getLowerCntCoefs_() const {
+    const auto totalUniqueWordsCnt = this->getTotalWordsUniqueCnt_();
+    if (totalUniqueWordsCnt == maxOrd) {
+      return {1, 0, 0};
+    }
+    // (maxOrd - unique total) * realLower + (ord - uniqueLower).
+    return {maxOrd - totalUniqueWordsCnt, 1, Count{0} - 1};
+  }
+
+ private:
+  friend class ael::impl::dict::SmallAdaptiveDictionaryBase<
+      maxOrd, SmallAdaptiveADictionary<maxOrd>>;
+};
+
+}  // namespace ael::dict
+
+#endif  // AEL_DICT_SMALL_ADAPTIVE_A_DICTIONARY_HPP
@@ -0,0 +1,59 @@
+#ifndef AEL_DICT_SMALL_ADAPTIVE_D_DICTIONARY_HPP
+#define AEL_DICT_SMALL_ADAPTIVE_D_DICTIONARY_HPP
+
+#include <ael/impl/dictionary/counts_options.hpp>
+#include <ael/impl/dictionary/small_adaptive_dictionary_base.hpp>
+#include <cstdint>
+
+namespace ael::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The SmallAdaptiveDDictionary class
+///
+/// Adaptive <<D>> dictionary for alphabets, which size is known at compile
+/// time and is small (bytes, nibbles). Same model as AdaptiveDDictionary.
+///
+template <std::uint64_t maxOrd>
+class SmallAdaptiveDDictionary
+    : public ael::impl::dict::SmallAdaptiveDictionaryBase<
+          maxOrd, SmallAdaptiveDDictionary<maxOrd>> {
+ public:
+  using Ord = std::uint64_t;
+  using Count = std::uint64_t;
+
+ public:
+  /**
+   * @brief SmallAdaptiveDDictionary constructor.
+   * @param rescaleThreshold - real total words count, exceeding which halves
+   * real counts of all words.
+   */
+  explicit SmallAdaptiveDDictionary(
+      Count rescaleThreshold = ael::impl::dict::noRescale)
+      : ael::impl::dict::SmallAdaptiveDictionaryBase<
+            maxOrd, SmallAdaptiveDDictionary<maxOrd>>(rescaleThreshold) {
+    this->recalcLowerCnts_();
+  }
+
+ private:
+  [[nodiscard]] ael::impl::dict::LowerCntCoefs getLowerCntCoefs_() const {
+    if (this->getRealTotalWordsCnt_() == 0) {
+      return {0, 1, 0};
+    }
+    const auto totalUniqueWordsCnt = this->getTotalWordsUniqueCnt_();
+    if (totalUniqueWordsCnt == maxOrd) {
+      return {1, 0, 0};
+    }
+    // (maxOrd - unique total) * 2 * realLower + ord * unique total -
+    // maxOrd * uniqueLower.
+    return {(maxOrd - totalUniqueWordsCnt) * 2, totalUniqueWordsCnt,
+            Count{0} - maxOrd};
+  }
+
+ private:
+  friend class ael::impl::dict::SmallAdaptiveDictionaryBase<
+      maxOrd, SmallAdaptiveDDictionary<maxOrd>>;
+};
+
+}  // namespace ael::dict
+
+#endif  // AEL_DICT_SMALL_ADAPTIVE_D_DICTIONARY_HPP
@@ -0,0 +1,57 @@
+#ifndef AEL_DICT_SMALL_ADAPTIVE_DICTIONARY_HPP
+#define AEL_DICT_SMALL_ADAPTIVE_DICTIONARY_HPP
+
+#include <ael/impl/dictionary/counts_options.hpp>
+#include <ael/impl/dictionary/small_adaptive_dictionary_base.hpp>
+#include <cstdint>
+
+namespace ael::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The SmallAdaptiveDictionary class
+///
+/// Adaptive dictionary for alphabets, which size is known at compile time and
+/// is small (bytes, nibbles). Same word counts as AdaptiveDictionary, but total
+/// count is exactly the sum of them.
+///
+template <std::uint64_t maxOrd>
+class SmallAdaptiveDictionary
+    : public ael::impl::dict::SmallAdaptiveDictionaryBase<
+          maxOrd, SmallAdaptiveDictionary<maxOrd>> {
+ public:
+  using Ord = std::uint64_t;
+  using Count = std::uint64_t;
+
+ public:
+  /**
+   * @brief SmallAdaptiveDictionary constructor.
+   * @param ratio - count of a word, which was met, relative to a word, which
+   * was not.
+   * @param rescaleThreshold - real total words count, exceeding which halves
+   * real counts of all words.
+   */
+  explicit SmallAdaptiveDictionary(
+      std::uint64_t ratio = 4,
+      Count rescaleThreshold = ael::impl::dict::noRescale)
+      : ael::impl::dict::SmallAdaptiveDictionaryBase<
+            maxOrd, SmallAdaptiveDictionary<maxOrd>>(rescaleThreshold),
+        ratio_{ratio} {
+    this->recalcLowerCnts_();
+  }
+
+ private:
+  [[nodiscard]] ael::impl::dict::LowerCntCoefs getLowerCntCoefs_() const {
+    return {ratio_, 1, 0};
+  }
+
+ private:
+  friend class ael::impl::dict::SmallAdaptiveDictionaryBase<
+      maxOrd, SmallAdaptiveDictionary<maxOrd>>;
+
+ private:
+  Count ratio_;
+};
+
+}  // namespace ael::dict
+
+#endif  // AEL_DICT_SMALL_ADAPTIVE_DICTIONARY_HPP
@@ -0,0 +1,114 @@
+#ifndef AEL_DICT_SORTED_ADAPTIVE_A_DICTIONARY_HPP
+#define AEL_DICT_SORTED_ADAPTIVE_A_DICTIONARY_HPP
+
+#include <ael/impl/dictionary/counts_options.hpp>
+#include <ael/impl/dictionary/decoded_word.hpp>
+#include <ael/impl/dictionary/max_ord_base.hpp>
+#include <ael/impl/dictionary/word_probability_stats.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ael::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The SortedAdaptiveADictionary class
+///
+/// Adaptive <<A>> dictionary, which keeps words sorted by count (like PPMd
+/// sorted stats). A word, which count was increased, is moved toward front
+/// past words with smaller counts. Word intervals are laid out in this order,
+/// so searching a word is a linear scan from the most frequent one, and
+/// words, which were not met, are found without a scan. Word probabilities
+/// are the same as of AdaptiveADictionary.
+///
+/// Good for small alphabets and skewed data. Worst case search is linear in
+/// alphabet size.
+///
+class SortedAdaptiveADictionary
+    : protected ael::impl::dict::MaxOrdBase<std::uint64_t> {
+ public:
+  using Ord = std::uint64_t;
+  using Count = std::uint64_t;
+  using ProbabilityStats = ael::impl::dict::WordProbabilityStats<Count>;
+  using DecodedWord = ael::impl::dict::DecodedWord<Count>;
+  constexpr const static std::uint16_t countNumBits = 62;
+
+ public:
+  SortedAdaptiveADictionary() = delete;
+
+  /**
+   * Sorted adaptive <<A>> dictionary constructor.
+   * @param maxOrd - maximal order.
+   * @param rescaleThreshold - real total words count, exceeding which
+   * halves real counts of all words.
+   */
+  explicit SortedAdaptiveADictionary(
+      Ord maxOrd, Count rescaleThreshold = ael::impl::dict::noRescale);
+
+  /**
+   * @brief getWordOrd - get word order index by cumulative count.
+   * @param cumulativeCnt - search key.
+   * @return word with exact cumulative number found.
+   */
+  [[nodiscard]] Ord getWordOrd(Count cumulativeCnt) const {
+    return entries_[findPos_(cumulativeCnt).pos].ord;
+  }
+
+  /**
+   * @brief getProbabilityStats - get probability stats and update.
+   * @param ord - order of a word.
+   * @return [low, high, total]
+   */
+  [[nodiscard]] ProbabilityStats getProbabilityStats(Ord ord);
+
+  /**
+   * @brief decodeSymbol - find a word by cumulative count, get its
+   * probability stats and update, in a single scan.
+   * @param cumulativeCnt - search key.
+   * @return [ord, low, high, total]
+   */
+  [[nodiscard]] DecodedWord decodeSymbol(Count cumulativeCnt);
+
+  /**
+   * @brief getTotalWordsCnt - get total words count estimation.
+   * @return total words count estimation.
+   */
+  [[nodiscard]] Count getTotalWordsCnt() const;
+
+ private:
+  struct Entry_ {
+    Ord ord;
+    Count cnt;
+  };
+
+  struct FoundPos_ {
+    std::size_t pos;
+    Count low;
+  };
+
+ private:
+  [[nodiscard]] Count getUnmetCnt_() const {
+    return getMaxOrd_() - uniqueWordsCnt_;
+  }
+
+  [[nodiscard]] Count getWordCnt_(Count realCnt) const;
+
+  [[nodiscard]] Count getLowerCumulativeCnt_(std::size_t pos) const;
+
+  [[nodiscard]] FoundPos_ findPos_(Count cumulativeCnt) const;
+
+  void updateWordCnt_(std::size_t pos);
+
+ private:
+  // Sorted by real count in nonincreasing order, so words, which were not met
+  // yet, are after `uniqueWordsCnt_` met ones.
+  std::vector<Entry_> entries_;
+  std::vector<std::size_t> positions_;
+  Count wordsCnt_{0};
+  Count uniqueWordsCnt_{0};
+  const Count rescaleThreshold_;
+};
+
+}  // namespace ael::dict
+
+#endif  // AEL_DICT_SORTED_ADAPTIVE_A_DICTIONARY_HPP
@@ -1,6 +1,7 @@
 #ifndef AEL_DICT_STATIC_DICTIONARY_HPP
 #define AEL_DICT_STATIC_DICTIONARY_HPP
 
+#include <ael/impl/dictionary/decoded_word.hpp>
 #include <ael/impl/dictionary/word_probability_stats.hpp>
 #include <cstdint>
 #include <map>
@@ -12,12 +13,26 @@ namespace ael::dict {
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief The StaticDictionary class
 ///
+/// For big alphabets a decode index is built: a table of buckets keyed by the
+/// top bits of a cumulative count. A bucket keeps the first word, which
+/// interval ends after the bucket start, so a search is narrowed to the words
+/// of one bucket, which is a few words on average.
+///
+/// If total count is a power of two, not greater than `2^lookupTableMaxLog2`
+/// (see normalizeCounts), a word is decoded by a lookup table instead.
+///
 class StaticDictionary {
  public:
   using Ord = std::uint64_t;
   using Count = std::uint64_t;
   using ProbabilityStats = ael::impl::dict::WordProbabilityStats<Count>;
+  using DecodedWord = ael::impl::dict::DecodedWord<Count>;
   constexpr static std::uint16_t countNumBits = 62;
+  /// Smallest alphabet size, for which decode index is built.
+  constexpr static Ord decodeIndexMinOrd = 64;
+  /// Greatest binary logarithm of total count, for which lookup table is
+  /// built.
+  constexpr static std::uint16_t lookupTableMaxLog2 = 16;
 
   struct CountMapping {
     Ord ord;
@@ -52,6 +67,14 @@ class StaticDictionary {
    */
   [[nodiscard]] ProbabilityStats getProbabilityStats(Ord ord);
 
+  /**
+   * @brief decodeSymbol - find a word by cumulative count and get its
+   * probability stats in a single search.
+   * @param cumulativeNumFound - search key.
+   * @return [ord, low, high, total]
+   */
+  [[nodiscard]] DecodedWord decodeSymbol(Count cumulativeNumFound) const;
+
   /**
    * @brief totalWordsCount
    * @return
@@ -60,6 +83,15 @@ class StaticDictionary {
     return *cumulativeNumFound_.rbegin();
   }
 
+  /**
+   * @brief getTotalWordsCntLog2 - binary logarithm of total words count.
+   * @return logarithm if total words count is a power of two, otherwise
+   * `impl::dict::unknownTotalWordsCntLog2`.
+   */
+  [[nodiscard]] std::uint16_t getTotalWordsCntLog2() const {
+    return totalWordsCntLog2_;
+  }
+
  private:
   [[nodiscard]] Count getLowerCumulativeCnt_(Ord ord) const;
 
@@ -67,12 +99,25 @@ class StaticDictionary {
     return cumulativeNumFound_[ord];
   }
 
+  void buildDecodeIndex_();
+
+  void buildLookupTable_();
+
+  [[nodiscard]] Ord findWord_(Count cumulativeNumFound) const;
+
  private:
   template <class Rng>
   std::map<Ord, Count> countCntMapping_(const Rng& countsRng);
 
  private:
   std::vector<Count> cumulativeNumFound_{};
+  std::uint16_t totalWordsCntLog2_{impl::dict::unknownTotalWordsCntLog2};
+  // Bucket `b` keeps the first word, which higher cumulative count is greater
+  // than `b << bucketShift_`. Empty, if there is no index.
+  std::vector<Ord> bucketWords_{};
+  std::uint16_t bucketShift_{0};
+  // Word of each cumulative count. Empty, if there is no table.
+  std::vector<std::uint32_t> lookupTable_{};
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -23,8 +23,7 @@ class UniformDictionary {
    * @brief UniformDictionary constructor.
    * @param maxOrd - maximal word order.
    */
-  explicit UniformDictionary(Ord maxOrd) : maxOrd_(maxOrd) {
-  }
+  explicit UniformDictionary(Ord maxOrd);
 
   /**
    * @brief getWord - get word by cumulative num found.
@@ -48,8 +47,18 @@ class UniformDictionary {
     return maxOrd_;
   }
 
+  /**
+   * @brief getTotalWordsCntLog2 - binary logarithm of total words count.
+   * @return logarithm if maxOrd is a power of two, otherwise
+   * `impl::dict::unknownTotalWordsCntLog2`.
+   */
+  [[nodiscard]] std::uint16_t getTotalWordsCntLog2() const {
+    return totalWordsCntLog2_;
+  }
+
  private:
   const Ord maxOrd_;
+  const std::uint16_t totalWordsCntLog2_;
 };
 
 }  // namespace ael::dict
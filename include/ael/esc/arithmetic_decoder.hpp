@@ -2,6 +2,7 @@
 #define AEL_ESC_ARITHMETIC_DECODER_HPP
 
 #include <ael/impl/multiply_and_divide.hpp>
+#include <algorithm>
 #include <ael/impl/range_and_value_save_base.hpp>
 #include <ael/impl/ranges_calc.hpp>
 #include <cstddef>
@@ -54,6 +55,16 @@ class ArithmeticDecoder
   template <typename CountT>
   CountT takeBit_();
 
+  template <typename CountT>
+  CountT takeBits_(std::size_t num);
+
+  template <class RC>
+  typename RC::Range renormalize_(typename RC::Range rng,
+                                  typename RC::Count& value);
+
+ private:
+  constexpr static std::size_t maxBitsAtOnce_ = SourceT::maxBitsAtOnce;
+
  private:
   SourceT* source_;
   const std::size_t bitsLimit_;
@@ -83,16 +94,14 @@ template <class SourceT>
 template <std::output_iterator<std::uint64_t> OutIter, class Dict>
 void ArithmeticDecoder<SourceT>::decode(Dict& dict, OutIter outIter,
                                         std::size_t wordsLimit, auto tick) {
-  using RC = impl::RangesCalc<typename Dict::Count, Dict::countNumBits>;
+  using RC = impl::RangesCalc<typename Dict::Count, Dict::countNumBits,
+                              impl::rangesCalcModeOf<Dict>>;
   auto currRange = this->template calcRange_<RC>();
   auto value = this->template calcValue_<RC>();
 
   for (auto i : std::ranges::iota_view(std::size_t{0}, wordsLimit)) {
-    const auto range = typename Dict::Count{currRange.high - currRange.low};
-    const auto dictTotalWords = dict.getTotalWordsCnt();
-    const auto offset = value - currRange.low + 1;
-    const auto aux =
-        impl::multiply_decrease_and_divide(offset, dictTotalWords, range);
+    const auto scaled = RC::scaleRange(currRange, dict.getTotalWordsCnt());
+    const auto aux = RC::calcDecodeTarget(scaled, value);
     const auto ord = dict.getWordOrd(aux);
 
     if (!dict.isEsc(ord)) {
@@ -101,22 +110,10 @@ void ArithmeticDecoder<SourceT>::decode(Dict& dict, OutIter outIter,
     }
 
     auto [low, high, total] = dict.getDecodeProbabilityStats(ord);
-    currRange = RC::rangeFromStatsAndPrev(currRange, {low, high, total});
+    currRange = RC::rangeFromScaledAndStats(scaled, {low, high, total});
     assert(high > low);
 
-    while (true) {
-      if (currRange.high <= RC::half) {
-        value = value * 2 + takeBit_<typename RC::Count>();
-      } else if (currRange.low >= RC::half) {
-        value = value * 2 - RC::total + takeBit_<typename RC::Count>();
-      } else if (currRange.low >= RC::quarter &&
-                 currRange.high <= RC::threeQuarters) {
-        value = value * 2 - RC::half + takeBit_<typename RC::Count>();
-      } else {
-        break;
-      }
-      currRange = RC::recalcRange(currRange);
-    }
+    currRange = renormalize_<RC>(currRange, value);
     tick();
   }
 
@@ -137,6 +134,60 @@ CountT ArithmeticDecoder<SourceT>::takeBit_() {
   return source_->takeBit() ? 1 : 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+template <class SourceT>
+template <class CountT>
+CountT ArithmeticDecoder<SourceT>::takeBits_(std::size_t num) {
+  auto ret = CountT{0};
+  while (num != 0) {
+    const auto chunk = std::min(num, maxBitsAtOnce_);
+    const auto available = std::min(chunk, bitsLimit_ - bitsDecoded_);
+    bitsDecoded_ += available;
+    const auto bits = static_cast<CountT>(source_->takeBits(available));
+    ret = (ret << chunk) | (bits << (chunk - available));
+    num -= chunk;
+  }
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class SourceT>
+template <class RC>
+auto ArithmeticDecoder<SourceT>::renormalize_(typename RC::Range rng,
+                                              typename RC::Count& value)
+    -> RC::Range {
+  using Count = typename RC::Count;
+  if constexpr (RC::bulkRenorm) {
+    // Shift in bits for all settled leading bits at once, then for all
+    // middle half expansions.
+    if (const auto settled = RC::countSettledBits(rng); settled != 0) {
+      value = (static_cast<Count>(value << settled) & (RC::total - 1)) |
+              takeBits_<Count>(settled);
+      rng = RC::shiftSettled(rng, settled);
+    }
+    if (const auto follow = RC::countFollowBits(rng); follow != 0) {
+      value = (value & RC::half) |
+              (static_cast<Count>(value << follow) & (RC::half - 1)) |
+              takeBits_<Count>(follow);
+      rng = RC::shiftFollow(rng, follow);
+    }
+    return rng;
+  } else {
+    while (true) {
+      if (rng.high <= RC::half) {
+        value = value * 2 + takeBit_<Count>();
+      } else if (rng.low >= RC::half) {
+        value = value * 2 - RC::total + takeBit_<Count>();
+      } else if (rng.low >= RC::quarter && rng.high <= RC::threeQuarters) {
+        value = value * 2 - RC::half + takeBit_<Count>();
+      } else {
+        return rng;
+      }
+      rng = RC::recalcRange(rng);
+    }
+  }
+}
+
 }  // namespace ael::esc
 
 #endif  // AEL_ESC_ARITHMETIC_DECODER_HPP
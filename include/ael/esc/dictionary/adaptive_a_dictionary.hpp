@@ -25,8 +25,11 @@ class AdaptiveADictionary : public ael::impl::esc::dict::ADDictionaryBase {
   /**
    * Adaptive <<A>> dictionary constructor.
    * @param maxOrd - maximal order.
+   * @param rescaleThreshold - real total words count, exceeding which
+   * halves real counts of all words.
    */
-  explicit AdaptiveADictionary(Ord maxOrd);
+  explicit AdaptiveADictionary(
+      Ord maxOrd, Count rescaleThreshold = ael::impl::dict::noRescale);
 
   /**
    * @brief getWordOrd - get word order index by cumulative count.
@@ -26,8 +26,11 @@ class AdaptiveDDictionary : public ael::impl::esc::dict::ADDictionaryBase {
   /**
    * Adaptive <<D>> dictionary constructor.
    * @param maxOrd - maximal order.
+   * @param rescaleThreshold - real total words count, exceeding which
+   * halves real counts of all words.
    */
-  explicit AdaptiveDDictionary(Ord maxOrd);
+  explicit AdaptiveDDictionary(
+      Ord maxOrd, Count rescaleThreshold = ael::impl::dict::noRescale);
 
   /**
    * @brief getWord - get word by cumulative num found.
@@ -1,13 +1,12 @@
 #ifndef AEL_ESC_DICT_PPMA_DICTIONARY_HPP
 #define AEL_ESC_DICT_PPMA_DICTIONARY_HPP
 
-#include <ael/impl/dictionary/cumulative_count.hpp>
-#include <ael/impl/dictionary/cumulative_unique_count.hpp>
+#include <ael/impl/dictionary/compact_cumulative_count.hpp>
+#include <ael/impl/dictionary/counts_options.hpp>
+#include <ael/impl/dictionary/ctx_tree.hpp>
 #include <ael/impl/esc/dictionary/ppm_a_d_dictionary_base.hpp>
 #include <boost/container/static_vector.hpp>
-#include <boost/container_hash/hash.hpp>
 #include <cstdint>
-#include <unordered_map>
 
 namespace ael::esc::dict {
 
@@ -18,8 +17,7 @@ class PPMADictionary
     : public ael::impl::esc::dict::PPMADDictionaryBase<PPMADictionary> {
  private:
   using Base_ = ael::impl::esc::dict::PPMADDictionaryBase<PPMADictionary>;
-  using CumulativeCount_ = ael::impl::dict::CumulativeCount;
-  using CumulativeUniqueCount_ = ael::impl::dict::CumulativeUniqueCount;
+  using CumulativeCount_ = ael::impl::dict::CompactCumulativeCount;
   constexpr static auto maxCtxLength_ = std::uint16_t{16};
   constexpr static std::uint16_t maxSeqLenLog2_ = 40;
 
@@ -34,6 +32,16 @@ class PPMADictionary
   struct ConstructInfo {
     Ord maxOrd{2};
     std::size_t ctxLength{0};
+    /// Total words count of a context, exceeding which halves all counts of
+    /// this context.
+    std::uint64_t rescaleThreshold{ael::impl::dict::noRescale};
+    /// Maximal number of contexts, which bounds model memory. Each context
+    /// keeps counts of words met in it, inline for a few words and sparse
+    /// for more.
+    std::size_t maxCtxsCnt{ael::impl::dict::noCtxsLimit};
+    /// What to do, when contexts limit is reached.
+    ael::impl::dict::CtxsLimitPolicy ctxsLimitPolicy{
+        ael::impl::dict::CtxsLimitPolicy::restart};
   };
 
  public:
@@ -42,7 +50,8 @@ class PPMADictionary
   /**
    * @brief PPMA dictionary with esc symbols constructor.
    *
-   * @param constructInfo - maximal order and context length.
+   * @param constructInfo - maximal order, context length and rescale
+   * threshold.
    */
   explicit PPMADictionary(ConstructInfo constructInfo);
 
@@ -97,13 +106,10 @@ class PPMADictionary
       SearchCtx_& currCtx) const;
 
  private:
-  using SearchCtxHash_ = boost::hash<SearchCtx_>;
-  using CtxCountMapping_ =
-      std::unordered_map<SearchCtx_, CumulativeCount_, SearchCtxHash_>;
+  using CtxCountMapping_ = ael::impl::dict::CtxTree<CumulativeCount_>;
 
  private:
   CumulativeCount_ zeroCtxCnt_;
-  CumulativeUniqueCount_ zeroCtxUniqueCnt_;
   CtxCountMapping_ ctxInfo_;
 
  private:
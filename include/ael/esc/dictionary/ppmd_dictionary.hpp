@@ -1,12 +1,12 @@
 #ifndef AEL_ESC_DICT_PPMD_DICTIONARY_HPP
 #define AEL_ESC_DICT_PPMD_DICTIONARY_HPP
 
-#include <ael/impl/dictionary/cumulative_count.hpp>
-#include <ael/impl/dictionary/cumulative_unique_count.hpp>
+#include <ael/impl/dictionary/compact_cumulative_count.hpp>
+#include <ael/impl/dictionary/counts_options.hpp>
+#include <ael/impl/dictionary/ctx_tree.hpp>
 #include <ael/impl/esc/dictionary/ppm_a_d_dictionary_base.hpp>
-#include <boost/container_hash/hash.hpp>
+#include <boost/container/static_vector.hpp>
 #include <cstdint>
-#include <unordered_map>
 
 namespace ael::esc::dict {
 
@@ -17,8 +17,6 @@ class PPMDDictionary
     : public ael::impl::esc::dict::PPMADDictionaryBase<PPMDDictionary> {
  private:
   using Base_ = ael::impl::esc::dict::PPMADDictionaryBase<PPMDDictionary>;
-  using CumulativeCount_ = impl::dict::CumulativeCount;
-  using CumulativeUniqueCount_ = impl::dict::CumulativeUniqueCount;
   constexpr static auto maxCtxLength_ = std::uint16_t{16};
   constexpr static std::uint16_t maxSeqLenLog2_ = 40;
 
@@ -33,6 +31,16 @@ class PPMDDictionary
   struct ConstructInfo {
     Ord maxOrd{2};
     std::size_t ctxLength{0};
+    /// Total words count of a context, exceeding which halves all counts of
+    /// this context.
+    std::uint64_t rescaleThreshold{ael::impl::dict::noRescale};
+    /// Maximal number of contexts, which bounds model memory. Each context
+    /// keeps counts of words met in it, inline for a few words and sparse
+    /// for more.
+    std::size_t maxCtxsCnt{ael::impl::dict::noCtxsLimit};
+    /// What to do, when contexts limit is reached.
+    ael::impl::dict::CtxsLimitPolicy ctxsLimitPolicy{
+        ael::impl::dict::CtxsLimitPolicy::restart};
   };
 
  public:
@@ -41,7 +49,8 @@ class PPMDDictionary
   /**
    * @brief PPMD dictionary with esc symbols constructor.
    *
-   * @param constructInfo - maximal order and context length.
+   * @param constructInfo - maximal order, context length and rescale
+   * threshold.
    */
   explicit PPMDDictionary(ConstructInfo constructInfo);
 
@@ -80,13 +89,7 @@ class PPMDDictionary
  protected:
   using SearchCtx_ = Base_::SearchCtx_;
 
-  struct CtxCell_ {
-    explicit CtxCell_(Ord maxOrd) : cnt(maxOrd), uniqueCnt(maxOrd) {
-    }
-
-    CumulativeCount_ cnt;
-    CumulativeUniqueCount_ uniqueCnt;
-  };
+  using CtxCell_ = ael::impl::dict::CompactCumulativeCount;
 
  protected:
   [[nodiscard]] ProbabilityStats getDecodeProbabilityStats_(Ord ord);
@@ -103,9 +106,7 @@ class PPMDDictionary
   [[nodiscard]] const CtxCell_& getCurrCtxCell_(SearchCtx_& currCtx) const;
 
  private:
-  using SearchCtxHash_ = boost::hash<SearchCtx_>;
-  using CtxCountMapping_ =
-      std::unordered_map<SearchCtx_, CtxCell_, SearchCtxHash_>;
+  using CtxCountMapping_ = ael::impl::dict::CtxTree<CtxCell_>;
 
  private:
   CtxCell_ zeroCtxCell_;
@@ -0,0 +1,237 @@
+#ifndef AEL_ESC_DICT_SPARSE_ALPHABET_DICTIONARY_HPP
+#define AEL_ESC_DICT_SPARSE_ALPHABET_DICTIONARY_HPP
+
+#include <ael/impl/dictionary/word_probability_stats.hpp>
+#include <algorithm>
+#include <bit>
+#include <boost/container/static_vector.hpp>
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ael::esc::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The SparseAlphabetDictionary class.
+///
+/// Front end for huge alphabets, of which only a few words are used. Words
+/// get dense indices in order of their first occurrence, and the wrapped
+/// dictionary models dense indices. Dense index 0 is an escape: a new word
+/// is coded as an escape and then as a raw ord of the huge alphabet. So
+/// search and model size depend on the number of met words, not on `maxOrd`.
+///
+/// Raw ord is coded uniformly in chunks of `rawChunkBits` bits, highest first,
+/// because a coder range can not hold a total of a 64-bit alphabet.
+///
+/// Wrapped dictionary is a dictionary without escapes, which is constructed
+/// from its maximal order and which updates on `getProbabilityStats`.
+///
+template <class DictT>
+class SparseAlphabetDictionary {
+ public:
+  using Ord = std::uint64_t;
+  using Count = typename DictT::Count;
+  using ProbabilityStats = ael::impl::dict::WordProbabilityStats<Count>;
+  constexpr const static std::uint16_t countNumBits = DictT::countNumBits;
+  /// Bits of a raw ord chunk. Its total fits a quarter of a coder range.
+  constexpr const static std::uint16_t rawChunkBits =
+      std::min(countNumBits - 2, 32);
+  using StatsSeq = boost::container::static_vector<
+      ProbabilityStats, 1 + (64 + rawChunkBits - 1) / rawChunkBits>;
+
+ public:
+  SparseAlphabetDictionary() = delete;
+
+  /**
+   * @brief SparseAlphabetDictionary constructor.
+   * @param maxOrd - maximal order of the huge alphabet.
+   * @param maxDenseOrd - maximal number of different words.
+   * @param dictArgs - wrapped dictionary constructor arguments after its
+   * maximal order.
+   */
+  template <class... ArgsT>
+  SparseAlphabetDictionary(Ord maxOrd, Ord maxDenseOrd, ArgsT&&... dictArgs);
+
+  /**
+   * @brief getWordOrd - get word order index by cumulative count.
+   * @param cumulativeCnt - search key.
+   * @return word ord, `maxOrd` for escape or a raw ord chunk.
+   */
+  [[nodiscard]] Ord getWordOrd(Count cumulativeCnt) const;
+
+  /**
+   * @brief get probability stats and update.
+   * @param ord - order of a word.
+   * @return escape and raw ord stats for a new word, word stats otherwise.
+   * @throws std::length_error if there are more than `maxDenseOrd` different
+   * words.
+   */
+  [[nodiscard]] StatsSeq getProbabilityStats(Ord ord);
+
+  /**
+   * @brief get probability stats for decoding and update.
+   * @param ord - word or escape returned by getWordOrd.
+   * @return [low, high, total]
+   */
+  [[nodiscard]] ProbabilityStats getDecodeProbabilityStats(Ord ord);
+
+  /**
+   * @brief totalWordsCount - get total words count estimation.
+   * @return total words count estimation
+   */
+  [[nodiscard]] Count getTotalWordsCnt() const;
+
+  /**
+   * @brief isEsc - check, if a decoded ord is not a word.
+   * @param ord - ord returned by getWordOrd.
+   * @return true for escape and for raw ord chunks before the last one.
+   */
+  [[nodiscard]] bool isEsc(Ord ord) const {
+    return rawChunksLeft_ == 0 ? ord == maxOrd_ : rawChunksLeft_ > 1;
+  }
+
+  /**
+   * @brief getMetWordsCnt - number of different met words.
+   * @return number of dense indices in use.
+   */
+  [[nodiscard]] Ord getMetWordsCnt() const {
+    return denseToOrd_.size();
+  }
+
+ private:
+  constexpr static Ord escDenseOrd_ = 0;
+
+ private:
+  [[nodiscard]] std::uint16_t getRawChunkShift_(
+      std::uint16_t chunksLeft) const {
+    return (chunksLeft - 1) * rawChunkBits;
+  }
+
+  [[nodiscard]] Count getRawChunkTotal_(std::uint16_t chunksLeft) const {
+    if (chunksLeft == rawChunksCnt_) {
+      return Count{((maxOrd_ - 1) >> getRawChunkShift_(chunksLeft)) + 1};
+    }
+    return Count{1} << rawChunkBits;
+  }
+
+  [[nodiscard]] ProbabilityStats getRawChunkStats_(
+      Ord ord, std::uint16_t chunksLeft) const {
+    const auto total = getRawChunkTotal_(chunksLeft);
+    auto chunk = Count{ord >> getRawChunkShift_(chunksLeft)};
+    if (chunksLeft != rawChunksCnt_) {
+      chunk &= total - 1;
+    }
+    return {chunk, chunk + 1, total};
+  }
+
+  Ord addWord_(Ord ord);
+
+ private:
+  DictT dict_;
+  Ord maxOrd_;
+  Ord maxDenseOrd_;
+  std::unordered_map<Ord, Ord> ordToDense_{};
+  std::vector<Ord> denseToOrd_{};
+  std::uint16_t rawChunksCnt_;
+  // Raw ord chunks left to decode after escape and high chunks decoded.
+  std::uint16_t rawChunksLeft_{0};
+  Ord rawOrdHigh_{0};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+template <class DictT>
+template <class... ArgsT>
+SparseAlphabetDictionary<DictT>::SparseAlphabetDictionary(Ord maxOrd,
+                                                          Ord maxDenseOrd,
+                                                          ArgsT&&... dictArgs)
+    : dict_(maxDenseOrd + 1, std::forward<ArgsT>(dictArgs)...),
+      maxOrd_{maxOrd},
+      maxDenseOrd_{maxDenseOrd},
+      rawChunksCnt_{static_cast<std::uint16_t>(
+          std::max(Ord{1}, (std::bit_width(maxOrd - 1) + rawChunkBits - 1) /
+                               rawChunkBits))} {
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class DictT>
+auto SparseAlphabetDictionary<DictT>::getWordOrd(Count cumulativeCnt) const
+    -> Ord {
+  if (rawChunksLeft_ != 0) {
+    return rawOrdHigh_ |
+           (Ord{cumulativeCnt} << getRawChunkShift_(rawChunksLeft_));
+  }
+  const auto denseOrd = dict_.getWordOrd(cumulativeCnt);
+  if (denseOrd == escDenseOrd_) {
+    return maxOrd_;
+  }
+  assert(denseOrd <= denseToOrd_.size() && "Unused dense index decoded.");
+  return denseToOrd_[denseOrd - 1];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class DictT>
+auto SparseAlphabetDictionary<DictT>::getProbabilityStats(Ord ord)
+    -> StatsSeq {
+  assert(!isEsc(ord) && "Ord can not be esc here.");
+  if (const auto denseIt = ordToDense_.find(ord);
+      denseIt != ordToDense_.end()) {
+    return {dict_.getProbabilityStats(denseIt->second)};
+  }
+  const auto denseOrd = addWord_(ord);
+  auto ret = StatsSeq{dict_.getProbabilityStats(escDenseOrd_)};
+  // The new word is counted as met, so its next occurrence is cheap.
+  [[maybe_unused]] const auto wordStats = dict_.getProbabilityStats(denseOrd);
+  for (auto chunksLeft = rawChunksCnt_; chunksLeft != 0; --chunksLeft) {
+    ret.push_back(getRawChunkStats_(ord, chunksLeft));
+  }
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class DictT>
+auto SparseAlphabetDictionary<DictT>::getDecodeProbabilityStats(Ord ord)
+    -> ProbabilityStats {
+  if (rawChunksLeft_ != 0) {
+    const auto ret = getRawChunkStats_(ord, rawChunksLeft_);
+    rawOrdHigh_ = ord;
+    if (--rawChunksLeft_ == 0) {
+      [[maybe_unused]] const auto wordStats =
+          dict_.getProbabilityStats(addWord_(ord));
+    }
+    return ret;
+  }
+  if (isEsc(ord)) {
+    rawChunksLeft_ = rawChunksCnt_;
+    rawOrdHigh_ = 0;
+    return dict_.getProbabilityStats(escDenseOrd_);
+  }
+  return dict_.getProbabilityStats(ordToDense_.at(ord));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class DictT>
+auto SparseAlphabetDictionary<DictT>::getTotalWordsCnt() const -> Count {
+  if (rawChunksLeft_ != 0) {
+    return getRawChunkTotal_(rawChunksLeft_);
+  }
+  return dict_.getTotalWordsCnt();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class DictT>
+auto SparseAlphabetDictionary<DictT>::addWord_(Ord ord) -> Ord {
+  if (denseToOrd_.size() == maxDenseOrd_) {
+    throw std::length_error("Too many different words.");
+  }
+  denseToOrd_.push_back(ord);
+  const auto denseOrd = static_cast<Ord>(denseToOrd_.size());
+  ordToDense_.emplace(ord, denseOrd);
+  return denseOrd;
+}
+
+}  // namespace ael::esc::dict
+
+#endif  // AEL_ESC_DICT_SPARSE_ALPHABET_DICTIONARY_HPP
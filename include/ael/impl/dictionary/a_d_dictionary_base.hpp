@@ -1,16 +1,20 @@
 #ifndef AEL_IMPL_DICT_A_D_DICTIONARY_BASE_HPP
 #define AEL_IMPL_DICT_A_D_DICTIONARY_BASE_HPP
 
-#include <ael/impl/dictionary/cumulative_count.hpp>
-#include <ael/impl/dictionary/cumulative_unique_count.hpp>
+#include <ael/impl/dictionary/cumulative_real_unique_count.hpp>
 #include <ael/impl/dictionary/max_ord_base.hpp>
 #include <cstdint>
+#include <memory_resource>
+#include <utility>
 
 namespace ael::impl::dict {
 
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief The base A/D dictionary base class.
 ///
+/// Real and unique counts are kept in one tree, so a query or a search probe
+/// reads one node for both of them.
+///
 class ADDictionaryBase : protected MaxOrdBase<std::uint64_t> {
  public:
   using Ord = MaxOrdBase::Ord;
@@ -20,7 +24,19 @@ class ADDictionaryBase : protected MaxOrdBase<std::uint64_t> {
   ADDictionaryBase() = delete;
 
  protected:
-  explicit ADDictionaryBase(Ord maxOrd);
+  /**
+   * @brief ADDictionaryBase constructor.
+   *
+   * @param maxOrd maximal order.
+   * @param layout counts storage layout.
+   * @param rescaleThreshold real total words count, exceeding which halves
+   * real counts of all words.
+   * @param resource memory resource of counts storage.
+   */
+  explicit ADDictionaryBase(
+      Ord maxOrd, CountsLayout layout = CountsLayout::automatic,
+      Count rescaleThreshold = noRescale,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
   /**
    * @brief get total words count without applying any model.
@@ -28,7 +44,7 @@ class ADDictionaryBase : protected MaxOrdBase<std::uint64_t> {
    * @return total processed words count.
    */
   [[nodiscard]] Count getRealTotalWordsCnt_() const {
-    return cumulativeCnt_.getTotalWordsCnt();
+    return cumulativeCnts_.getRealTotalWordsCnt();
   }
 
   /**
@@ -38,7 +54,7 @@ class ADDictionaryBase : protected MaxOrdBase<std::uint64_t> {
    * @return real cumulative count of a word.
    */
   [[nodiscard]] Count getRealLowerCumulativeWordCnt_(Ord ord) const {
-    return cumulativeCnt_.getLowerCumulativeCnt(ord);
+    return cumulativeCnts_.getLowerCumulativeCnts(ord).real;
   }
 
   /**
@@ -48,7 +64,7 @@ class ADDictionaryBase : protected MaxOrdBase<std::uint64_t> {
    * @return real count of a word.
    */
   [[nodiscard]] Count getRealWordCnt_(Ord ord) const {
-    return cumulativeCnt_.getCount(ord);
+    return cumulativeCnts_.getRealCount(ord);
   }
 
   /**
@@ -57,7 +73,7 @@ class ADDictionaryBase : protected MaxOrdBase<std::uint64_t> {
    * @return real total words counts.
    */
   [[nodiscard]] Count getTotalWordsUniqueCnt_() const {
-    return cumulativeUniqueCnt_.getTotalWordsCnt();
+    return cumulativeCnts_.getUniqueTotalWordsCnt();
   }
 
   /**
@@ -67,7 +83,18 @@ class ADDictionaryBase : protected MaxOrdBase<std::uint64_t> {
    * @return lower cumulative unique count.
    */
   [[nodiscard]] Count getLowerCumulativeUniqueNumFound_(Ord ord) const {
-    return cumulativeUniqueCnt_.getLowerCumulativeCnt(ord);
+    return cumulativeCnts_.getLowerCumulativeCnts(ord).unique;
+  }
+
+  /**
+   * @brief get lower cumulative real and unique counts in one tree walk.
+   *
+   * @param ord index of a word.
+   * @return lower cumulative real and unique counts.
+   */
+  [[nodiscard]] CumulativeRealUniqueCount::Counts getLowerCumulativeCnts_(
+      Ord ord) const {
+    return cumulativeCnts_.getLowerCumulativeCnts(ord);
   }
 
   /**
@@ -78,7 +105,17 @@ class ADDictionaryBase : protected MaxOrdBase<std::uint64_t> {
    * was found).
    */
   [[nodiscard]] Count getWordUniqueCnt_(Ord ord) const {
-    return cumulativeUniqueCnt_.getCount(ord);
+    return Count{cumulativeCnts_.getRealCount(ord) != 0 ? 1U : 0U};
+  }
+
+  /**
+   * @brief get a word, which was not met yet, by its index among such words.
+   *
+   * @param num index of a word among not met ones.
+   * @return word ord.
+   */
+  [[nodiscard]] Ord getNthUnmetOrd_(Count num) const {
+    return cumulativeCnts_.getNthUnmetOrd(num);
   }
 
   /**
@@ -89,11 +126,60 @@ class ADDictionaryBase : protected MaxOrdBase<std::uint64_t> {
    */
   void updateWordCnt_(Ord ord, Count cnt);
 
+  /**
+   * @brief halve real counts of all words. Unique counts are not changed.
+   */
+  void halveWordsCnts_() {
+    cumulativeCnts_.halveCounts();
+  }
+
+  /**
+   * @brief find the last word, which lower cumulative count in a model is not
+   * greater than target. Real and unique counts are descended at once.
+   *
+   * @param target cumulative count to search.
+   * @param calcLowerCnt model lower cumulative count getter by ord, its real
+   * lower cumulative count and lower cumulative unique count. Must not
+   * decrease with ord.
+   * @return found word and its lower cumulative count in a model.
+   */
+  template <class CalcLowerCntT>
+  [[nodiscard]] std::pair<Ord, Count> findLastNotGreater_(
+      Count target, CalcLowerCntT calcLowerCnt) const;
+
  private:
-  CumulativeCount cumulativeCnt_;
-  CumulativeUniqueCount cumulativeUniqueCnt_;
+  CumulativeRealUniqueCount cumulativeCnts_;
 };
 
+////////////////////////////////////////////////////////////////////////////////
+template <class CalcLowerCntT>
+auto ADDictionaryBase::findLastNotGreater_(Count target,
+                                           CalcLowerCntT calcLowerCnt) const
+    -> std::pair<Ord, Count> {
+  auto ord = Ord{0};
+  auto realLowerCnt = Count{0};
+  auto uniqueLowerCnt = Count{0};
+  auto lowerCnt = calcLowerCnt(Ord{0}, Count{0}, Count{0});
+  for (auto step = cumulativeCnts_.getSearchStep(); step != 0; step >>= 1) {
+    const auto next = ord + step;
+    if (next > getMaxOrd_()) {
+      continue;
+    }
+    const auto [nodeRealCnt, nodeUniqueCnt] = cumulativeCnts_.getNodeCnts(next);
+    const auto nextRealLowerCnt = realLowerCnt + nodeRealCnt;
+    const auto nextUniqueLowerCnt = uniqueLowerCnt + nodeUniqueCnt;
+    if (const auto nextLowerCnt =
+            calcLowerCnt(next, nextRealLowerCnt, nextUniqueLowerCnt);
+        nextLowerCnt <= target) {
+      ord = next;
+      realLowerCnt = nextRealLowerCnt;
+      uniqueLowerCnt = nextUniqueLowerCnt;
+      lowerCnt = nextLowerCnt;
+    }
+  }
+  return {ord, lowerCnt};
+}
+
 }  // namespace ael::impl::dict
 
 #endif  // AEL_IMPL_DICT_A_D_DICTIONARY_BASE_HPP
@@ -1,10 +1,11 @@
 #ifndef AEL_IMPL_DICT_ADAPTIVE_DICTIONARY_BASE_HPP
 #define AEL_IMPL_DICT_ADAPTIVE_DICTIONARY_BASE_HPP
 
+#include <ael/impl/dictionary/counts_options.hpp>
+#include <ael/impl/dictionary/fenwick_tree.hpp>
 #include <ael/impl/dictionary/max_ord_base.hpp>
 #include <cstdint>
-#include <dst/dynamic_segment_tree.hpp>
-#include <unordered_map>
+#include <utility>
 
 namespace ael::impl::dict {
 
@@ -23,12 +24,11 @@ class AdaptiveDictionaryBase
   AdaptiveDictionaryBase() = delete;
 
  protected:
-  AdaptiveDictionaryBase(Ord maxOrd, Count initialTotalWordsCount);
+  AdaptiveDictionaryBase(Ord maxOrd, Count initialTotalWordsCount,
+                         Count rescaleThreshold = noRescale);
 
   [[nodiscard]] Count getRealWordCnt_(Ord ord) const;
 
-  void changeRealCumulativeWordCnt_(Ord ord, std::int64_t cntChange);
-
   void changeRealWordCnt_(Ord ord, std::int64_t cntChange);
 
   void changeRealTotalWordsCnt_(std::int64_t cntChange);
@@ -37,44 +37,51 @@ class AdaptiveDictionaryBase
 
   [[nodiscard]] Count getRealCumulativeCnt_(Ord ord) const;
 
- protected:
-  using DST_ =
-      dst::DynamicSegmentTree<Ord, Count, void, dst::NoRangeGetOp,
-                              dst::NoRangeGetOp, std::plus<void>, std::int64_t>;
+  /**
+   * @brief halve real counts of all words, if real total words count exceeds
+   * rescale threshold.
+   */
+  void rescaleIfNeeded_();
+
+  /**
+   * @brief find the last word, which lower cumulative count in a model is not
+   * greater than target, in a single counts tree descent.
+   * @param target - cumulative count to search.
+   * @param calcLowerCnt - model lower cumulative count getter by ord and its
+   * real lower cumulative count. Must not decrease with ord.
+   * @return found word and its lower cumulative count in a model.
+   */
+  template <class CalcLowerCntT>
+  [[nodiscard]] std::pair<Ord, Count> findLastNotGreater_(
+      Count target, CalcLowerCntT calcLowerCnt) const;
 
  private:
-  DST_ cumulativeWordCounts_;
-  std::unordered_map<Ord, Count> wordCnts_{};
+  FenwickTree<Count> cumulativeWordCounts_;
   Count totalWordsCnt_;
+  const Count rescaleThreshold_;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
 template <typename CountT>
 AdaptiveDictionaryBase<CountT>::AdaptiveDictionaryBase(
-    Ord maxOrd, Count initialTotalWordsCount)
+    Ord maxOrd, Count initialTotalWordsCount, Count rescaleThreshold)
     : MaxOrdBase(maxOrd),
-      cumulativeWordCounts_{Ord{0}, maxOrd, 0},
-      totalWordsCnt_{initialTotalWordsCount} {
+      cumulativeWordCounts_{maxOrd},
+      totalWordsCnt_{initialTotalWordsCount},
+      rescaleThreshold_{rescaleThreshold} {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 template <typename CountT>
 auto AdaptiveDictionaryBase<CountT>::getRealWordCnt_(Ord ord) const -> Count {
-  return wordCnts_.contains(ord) ? wordCnts_.at(ord) : 0;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-template <typename CountT>
-void AdaptiveDictionaryBase<CountT>::changeRealCumulativeWordCnt_(
-    Ord ord, std::int64_t cntChange) {
-  cumulativeWordCounts_.update(ord, this->getMaxOrd_(), cntChange);
+  return cumulativeWordCounts_.getCount(ord);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 template <typename CountT>
 void AdaptiveDictionaryBase<CountT>::changeRealWordCnt_(
     Ord ord, std::int64_t cntChange) {
-  wordCnts_[ord] += cntChange;
+  cumulativeWordCounts_.update(ord, static_cast<Count>(cntChange));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -94,7 +101,41 @@ auto AdaptiveDictionaryBase<CountT>::getRealTotalWordsCnt_() const -> Count {
 template <typename CountT>
 auto AdaptiveDictionaryBase<CountT>::getRealCumulativeCnt_(Ord ord) const
     -> Count {
-  return cumulativeWordCounts_.get(ord);
+  return cumulativeWordCounts_.getLowerCumulativeCnt(ord + 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <typename CountT>
+void AdaptiveDictionaryBase<CountT>::rescaleIfNeeded_() {
+  if (totalWordsCnt_ > rescaleThreshold_) {
+    totalWordsCnt_ -= cumulativeWordCounts_.halveCounts();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <typename CountT>
+template <class CalcLowerCntT>
+auto AdaptiveDictionaryBase<CountT>::findLastNotGreater_(
+    Count target, CalcLowerCntT calcLowerCnt) const -> std::pair<Ord, Count> {
+  auto ord = Ord{0};
+  auto realLowerCnt = Count{0};
+  auto lowerCnt = calcLowerCnt(Ord{0}, Count{0});
+  for (auto step = cumulativeWordCounts_.getSearchStep(); step != 0;
+       step >>= 1) {
+    const auto next = ord + step;
+    if (next > this->getMaxOrd_()) {
+      continue;
+    }
+    const auto nextRealLowerCnt =
+        realLowerCnt + cumulativeWordCounts_.getNodeCnt(next);
+    if (const auto nextLowerCnt = calcLowerCnt(next, nextRealLowerCnt);
+        nextLowerCnt <= target) {
+      ord = next;
+      realLowerCnt = nextRealLowerCnt;
+      lowerCnt = nextLowerCnt;
+    }
+  }
+  return {ord, lowerCnt};
 }
 
 }  // namespace ael::impl::dict
@@ -0,0 +1,130 @@
+#ifndef AEL_IMPL_DICT_COMPACT_CUMULATIVE_COUNT_HPP
+#define AEL_IMPL_DICT_COMPACT_CUMULATIVE_COUNT_HPP
+
+#include <ael/impl/dictionary/counts_options.hpp>
+#include <ael/impl/dictionary/cumulative_real_unique_count.hpp>
+#include <ael/impl/dictionary/fenwick_tree.hpp>
+#include <array>
+#include <cstdint>
+#include <memory_resource>
+
+namespace ael::impl::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The CompactCumulativeCount class.
+///
+/// Real and unique counts of a model, which usually meets a few different
+/// words, like a PPM context. Up to `inlineMaxWordsCnt` words are kept inline
+/// as (ord, count) pairs sorted by ord, and queries are short linear scans.
+/// Next different word moves counts to a CumulativeRealUniqueCount, which is
+/// allocated from the memory resource.
+///
+/// Real counts are only increased or halved rounding up, so a word is met
+/// exactly when its real count is not zero.
+///
+class CompactCumulativeCount {
+ public:
+  using Ord = std::uint64_t;
+  using Count = std::uint64_t;
+
+  /// Maximal number of different words kept inline.
+  constexpr static std::size_t inlineMaxWordsCnt = 4;
+
+ public:
+  CompactCumulativeCount() = delete;
+
+  /**
+   * @brief CompactCumulativeCount constructor.
+   * @param maxOrd - maximal order.
+   * @param layout - counts storage layout after inline words are moved out.
+   * @param rescaleThreshold - real total words count, exceeding which halves
+   * real counts of all words.
+   * @param resource - memory resource of counts storage.
+   */
+  explicit CompactCumulativeCount(
+      Ord maxOrd, CountsLayout layout = CountsLayout::automatic,
+      Count rescaleThreshold = noRescale,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+  CompactCumulativeCount(const CompactCumulativeCount&) = delete;
+  CompactCumulativeCount(CompactCumulativeCount&& other) noexcept;
+  CompactCumulativeCount& operator=(const CompactCumulativeCount&) = delete;
+  CompactCumulativeCount& operator=(CompactCumulativeCount&&) = delete;
+  ~CompactCumulativeCount();
+
+  /**
+   * @brief increaseOrdCount - increase real count of a word and rescale real
+   * counts, if real total words count exceeds rescale threshold.
+   * @param ord - order index of a word.
+   * @param cntChange - positive count increase.
+   */
+  void increaseOrdCount(Ord ord, std::int64_t cntChange);
+
+  /**
+   * @brief getLowerCumulativeCnt - sum of real counts of ords [0, ord).
+   * @param ord - order index of a word.
+   * @return lower cumulative real count.
+   */
+  [[nodiscard]] Count getLowerCumulativeCnt(Ord ord) const;
+
+  /**
+   * @brief getCount - real count of one word.
+   * @param ord - order index of a word.
+   * @return real word count.
+   */
+  [[nodiscard]] Count getCount(Ord ord) const;
+
+  [[nodiscard]] Count getTotalWordsCnt() const {
+    return tree_ != nullptr ? tree_->getRealTotalWordsCnt() : totalWordsCnt_;
+  }
+
+  /**
+   * @brief getLowerUniqueCnt - number of met words in [0, ord).
+   * @param ord - order index of a word.
+   * @return lower cumulative unique count.
+   */
+  [[nodiscard]] Count getLowerUniqueCnt(Ord ord) const;
+
+  [[nodiscard]] Count getUniqueCount(Ord ord) const {
+    return getCount(ord) != 0 ? 1 : 0;
+  }
+
+  [[nodiscard]] Count getUniqueTotalWordsCnt() const {
+    return tree_ != nullptr ? tree_->getUniqueTotalWordsCnt() : wordsCnt_;
+  }
+
+  /**
+   * @brief getNthUnmetOrd - select a word, which was not met yet.
+   * @param num - index of a word among not met ones.
+   * @return word ord.
+   */
+  [[nodiscard]] Ord getNthUnmetOrd(Count num) const;
+
+  /**
+   * @brief isInline - check, if counts are kept inline.
+   * @return true if no more than `inlineMaxWordsCnt` words were met.
+   */
+  [[nodiscard]] bool isInline() const {
+    return tree_ == nullptr;
+  }
+
+ private:
+  void moveToTree_();
+
+  void halveInlineCounts_();
+
+ private:
+  std::array<Ord, inlineMaxWordsCnt> ords_{};
+  std::array<Count, inlineMaxWordsCnt> cnts_{};
+  Count totalWordsCnt_{0};
+  CumulativeRealUniqueCount* tree_{nullptr};
+  std::pmr::memory_resource* resource_;
+  const Count rescaleThreshold_;
+  const Ord maxOrd_;
+  std::uint8_t wordsCnt_{0};
+  const CountsLayout layout_;
+};
+
+}  // namespace ael::impl::dict
+
+#endif  // AEL_IMPL_DICT_COMPACT_CUMULATIVE_COUNT_HPP
@@ -2,6 +2,7 @@
 #define AEL_IMPL_DICT_CONTEXTUAL_DICTIONARY_BASE_HPP
 
 #include <ael/impl/dictionary/contextual_dictionary_stats_base.hpp>
+#include <ael/impl/dictionary/decoded_word.hpp>
 #include <ael/impl/dictionary/word_probability_stats.hpp>
 #include <cstdint>
 #include <optional>
@@ -21,6 +22,7 @@ class ContextualDictionaryBase
   using Ord = std::uint64_t;
   using Count = std::uint64_t;
   using ProbabilityStats = WordProbabilityStats<Count>;
+  using DecodedWord = ael::impl::dict::DecodedWord<Count>;
   constexpr const static std::uint16_t countNumBits = 62;
 
  public:
@@ -40,6 +42,14 @@ class ContextualDictionaryBase
    */
   [[nodiscard]] ProbabilityStats getProbabilityStats(Ord ord);
 
+  /**
+   * @brief decodeSymbol - find a word by cumulative count, get its
+   * probability stats and update, in a single search.
+   * @param cumulativeNumFound - search key.
+   * @return [ord, low, high, total]
+   */
+  [[nodiscard]] DecodedWord decodeSymbol(Count cumulativeNumFound);
+
   /**
    * @brief getTotalWordsCount get total number of words according to model.
    * @return totalWordsCount according to dictionary model.
@@ -80,6 +90,40 @@ auto ContextualDictionaryBase<InternalDictT>::getProbabilityStats(Ord ord)
   return ret.value();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+template <class InternalDictT>
+auto ContextualDictionaryBase<InternalDictT>::decodeSymbol(
+    Count cumulativeNumFound) -> DecodedWord {
+  std::optional<DecodedWord> ret{};
+  auto decodedCtxLength = std::uint16_t{0};
+  for (auto ctxLength = this->getCurrCtxLength_(); ctxLength != 0;
+       --ctxLength) {
+    if (const auto searchCtx = this->getSearchCtx_(ctxLength);
+        this->ctxExists_(searchCtx)) {
+      ret = this->decodeContextualWord_(searchCtx, cumulativeNumFound);
+      decodedCtxLength = ctxLength;
+      break;
+    }
+  }
+  if (!ret.has_value()) {
+    ret = InternalDictT::findWord_(cumulativeNumFound);
+  }
+  const auto ord = ret->ord;
+  // Same updates as in getProbabilityStats. Context, which the word was
+  // decoded in, is already updated once by decodeSymbol.
+  for (auto ctxLength = this->getCurrCtxLength_(); ctxLength != 0;
+       --ctxLength) {
+    const auto searchCtx = this->getSearchCtx_(ctxLength);
+    if (ctxLength != decodedCtxLength && this->ctxExists_(searchCtx)) {
+      this->updateContextualDictionary_(searchCtx, ord);
+    }
+    this->updateContextualDictionary_(searchCtx, ord);
+  }
+  this->updateWordCnt_(ord, 1);
+  this->updateCtx_(ord);
+  return ret.value();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 template <class InternalDictT>
 auto ContextualDictionaryBase<InternalDictT>::getTotalWordsCnt() const
@@ -3,8 +3,13 @@
 
 #include <boost/multiprecision/cpp_int.hpp>
 #include <cstdint>
+#include <memory>
+#include <memory_resource>
 #include <unordered_map>
 
+#include "counts_options.hpp"
+#include "decoded_word.hpp"
+#include "fenwick_tree.hpp"
 #include "word_probability_stats.hpp"
 
 namespace ael::impl::dict {
@@ -14,6 +19,8 @@ namespace bm = boost::multiprecision;
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief The ContextualDictionaryStatsBase<InternalDict> class
 ///
+/// Context dictionaries are allocated from a model pool, as in CtxLinks.
+///
 template <class InternalDict>
 class ContextualDictionaryStatsBase : protected InternalDict {
  private:
@@ -45,6 +52,9 @@ class ContextualDictionaryStatsBase : protected InternalDict {
     std::uint16_t wordNumBits{1 << CHAR_BIT};
     std::uint16_t ctxLength{0};
     std::uint16_t ctxCellBitsLength{0};
+    /// Real total words count of a context, exceeding which halves real
+    /// counts of this context. The empty context is rescaled too.
+    Count rescaleThreshold{noRescale};
   };
 
  public:
@@ -74,12 +84,19 @@ class ContextualDictionaryStatsBase : protected InternalDict {
   WordProbabilityStats<Count> getContextualProbStats_(
       const SearchCtx_& searchCtx, Ord ord);
 
+  DecodedWord<Count> decodeContextualWord_(const SearchCtx_& searchCtx,
+                                           Count cumulativeCnt);
+
   [[nodiscard]] std::uint16_t getCurrCtxLength_() const;
 
   [[nodiscard]] bool ctxExists_(const SearchCtx_& searchCtx) const;
 
  private:
-  std::unordered_map<SearchCtx_, Dict_, SearchCtxHash_> contextProbs_{};
+  std::unique_ptr<std::pmr::unsynchronized_pool_resource> ctxsResource_{
+      std::make_unique<std::pmr::unsynchronized_pool_resource>()};
+  std::pmr::unordered_map<SearchCtx_, Dict_, SearchCtxHash_> contextProbs_{
+      ctxsResource_.get()};
+  const Count rescaleThreshold_{noRescale};
   const std::uint16_t ctxCellBitsLength_{0};
   const std::uint16_t ctxLength_{0};
   const std::uint16_t numBits_{1 << CHAR_BIT};
@@ -91,10 +108,12 @@ class ContextualDictionaryStatsBase : protected InternalDict {
 template <class InternalDictT>
 ContextualDictionaryStatsBase<InternalDictT>::ContextualDictionaryStatsBase(
     ConstructInfo constructInfo)
-    : ctxCellBitsLength_(constructInfo.ctxCellBitsLength),
+    : InternalDictT(1ull << constructInfo.wordNumBits, CountsLayout::automatic,
+                    constructInfo.rescaleThreshold),
+      rescaleThreshold_(constructInfo.rescaleThreshold),
+      ctxCellBitsLength_(constructInfo.ctxCellBitsLength),
       ctxLength_(constructInfo.ctxLength),
-      numBits_(constructInfo.wordNumBits),
-      InternalDictT(1ull << constructInfo.wordNumBits) {
+      numBits_(constructInfo.wordNumBits) {
   if (ctxCellBitsLength_ * ctxLength_ > maxCtxBits_) {
     throw std::invalid_argument("Too big context length.");
   }
@@ -149,7 +168,10 @@ template <class InternalDictT>
 void ContextualDictionaryStatsBase<InternalDictT>::updateContextualDictionary_(
     const SearchCtx_& searchCtx, Ord ord) {
   if (!contextProbs_.contains(searchCtx)) {
-    contextProbs_.emplace(searchCtx, this->getMaxOrd_());
+    // Most contexts meet a few words, so counts are kept sparse.
+    contextProbs_.try_emplace(searchCtx, this->getMaxOrd_(),
+                              CountsLayout::sparse, rescaleThreshold_,
+                              ctxsResource_.get());
   }
   contextProbs_.at(searchCtx).updateWordCnt_(ord, 1);
 }
@@ -161,6 +183,13 @@ auto ContextualDictionaryStatsBase<InternalDictT>::getContextualProbStats_(
   return contextProbs_.at(searchCtx).getProbabilityStats(ord);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+template <class InternalDictT>
+auto ContextualDictionaryStatsBase<InternalDictT>::decodeContextualWord_(
+    const SearchCtx_& searchCtx, Count cumulativeCnt) -> DecodedWord<Count> {
+  return contextProbs_.at(searchCtx).decodeSymbol(cumulativeCnt);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 template <class InternalDictT>
 std::uint16_t ContextualDictionaryStatsBase<InternalDictT>::getCurrCtxLength_()
@@ -0,0 +1,27 @@
+#ifndef AEL_IMPL_DICT_COUNTS_OPTIONS_HPP
+#define AEL_IMPL_DICT_COUNTS_OPTIONS_HPP
+
+#include <cstdint>
+#include <limits>
+
+namespace ael::impl::dict {
+
+/// Rescale threshold, which disables counts rescaling.
+constexpr auto noRescale = std::numeric_limits<std::uint64_t>::max();
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Counts storage layout.
+///
+enum class CountsLayout {
+  /// Dense for alphabets up to `FenwickTree::denseMaxOrd`, sparse otherwise.
+  automatic,
+  /// Only nonzero values are kept in hash maps. Good for huge alphabets and
+  /// for many small models (like PPM contexts).
+  sparse,
+  /// Contiguous arrays of `maxOrd + 1` values. No allocation on update.
+  dense,
+};
+
+}  // namespace ael::impl::dict
+
+#endif  // AEL_IMPL_DICT_COUNTS_OPTIONS_HPP
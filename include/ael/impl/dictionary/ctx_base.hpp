@@ -1,34 +1,79 @@
 #ifndef AEL_IMPL_DICT_CTX_BASE_HPP
 #define AEL_IMPL_DICT_CTX_BASE_HPP
 
-#include <boost/container/static_vector.hpp>
+#include <ael/impl/context_buffer.hpp>
+#include <ael/impl/dictionary/ctx_tree.hpp>
 #include <cstddef>
 #include <cstdint>
-#include <deque>
+#include <limits>
+#include <stdexcept>
 
 namespace ael::impl::dict {
 
+constexpr auto noCtxsLimit = std::numeric_limits<std::size_t>::max();
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief What a context model does, when its contexts limit is reached.
+///
+/// Encoder and decoder see the same words, so they apply a policy at the same
+/// moment with the same result.
+///
+enum class CtxsLimitPolicy {
+  /// Drop all contexts and their statistics, keeping the current context.
+  restart,
+  /// Drop rarely met contexts, until half of the limit is used.
+  prune,
+  /// Keep statistics of met contexts and stop creating new ones.
+  freeze
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief The CtxBase<OrdT> - context base class.
 ///
+/// Contexts are nodes of `DictT::ctxInfo_` context tree, so a search context
+/// is a cursor, which is shortened by suffix links. Last words are also kept
+/// in a ring buffer, so the current context can be entered again after the
+/// tree is reset.
+///
+/// Number of contexts is bounded by a limit, which is checked before a word
+/// is added, so the limit is never exceeded.
+///
 template <class DictT, typename OrdT, std::uint16_t maxCtxLength>
 class CtxBase {
  protected:
   using Ord = OrdT;
-  using SearchCtx_ = boost::container::static_vector<Ord, maxCtxLength>;
+  using SearchCtx_ = CtxCursor;
 
  protected:
-  explicit CtxBase(std::size_t ctxLength) : ctxLength_{ctxLength} {
-  }
+  /**
+   * @brief CtxBase constructor.
+   * @param ctxLength - context length.
+   * @param maxCtxsCnt - maximal number of contexts including the empty one.
+   * @param ctxsLimitPolicy - what to do, when contexts limit is reached.
+   */
+  explicit CtxBase(std::size_t ctxLength,
+                   std::size_t maxCtxsCnt = noCtxsLimit,
+                   CtxsLimitPolicy ctxsLimitPolicy = CtxsLimitPolicy::restart);
 
+  /**
+   * @brief updateCtx_ - add a word to the context. Contexts limit policy is
+   * applied before, so cursors to contexts must not be used after update.
+   * @param ord - order of a word.
+   */
   void updateCtx_(Ord ord);
 
+  /**
+   * @brief resetCtxs_ - drop all contexts and their statistics, keeping the
+   * current context.
+   */
+  void resetCtxs_();
+
   [[nodiscard]] std::size_t getCtxLength_() const {
     return ctxLength_;
   }
 
   [[nodiscard]] SearchCtx_ getInitSearchCtx_() const {
-    return SearchCtx_(ctx_.rbegin(), ctx_.rend());
+    return static_cast<const DictT*>(this)->ctxInfo_.getCurrCtx();
   }
 
   void skipNewCtxs_(SearchCtx_& currCtx) const;
@@ -37,15 +82,57 @@ class CtxBase {
 
  private:
   const std::size_t ctxLength_;
-  std::deque<Ord> ctx_{};
+  const std::size_t maxCtxsCnt_;
+  const CtxsLimitPolicy ctxsLimitPolicy_;
+  ContextBuffer<Ord, maxCtxLength> lastWords_;
 };
 
+////////////////////////////////////////////////////////////////////////////////
+template <class DictT, typename OrdT, std::uint16_t maxCtxLength>
+CtxBase<DictT, OrdT, maxCtxLength>::CtxBase(std::size_t ctxLength,
+                                            std::size_t maxCtxsCnt,
+                                            CtxsLimitPolicy ctxsLimitPolicy)
+    : ctxLength_{ctxLength},
+      maxCtxsCnt_{maxCtxsCnt},
+      ctxsLimitPolicy_{ctxsLimitPolicy},
+      lastWords_(ctxLength) {
+  // Restart enters the current context, which creates up to
+  // ctxLength * (ctxLength + 1) / 2 contexts, and the next word adds up to
+  // ctxLength more.
+  if (maxCtxsCnt < 1 + ctxLength * (ctxLength + 3) / 2) {
+    throw std::logic_error("Too small contexts limit.");
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 template <class DictT, typename OrdT, std::uint16_t maxCtxLength>
 void CtxBase<DictT, OrdT, maxCtxLength>::updateCtx_(Ord ord) {
-  ctx_.push_back(ord);
-  if (ctx_.size() > ctxLength_) {
-    ctx_.pop_front();
+  auto& ctxInfo = static_cast<DictT*>(this)->ctxInfo_;
+  // A word adds at most `ctxLength_` contexts.
+  if (ctxInfo.getNodesCnt() + ctxLength_ > maxCtxsCnt_) {
+    switch (ctxsLimitPolicy_) {
+      case CtxsLimitPolicy::restart:
+        resetCtxs_();
+        break;
+      case CtxsLimitPolicy::prune:
+        ctxInfo.prune(maxCtxsCnt_ / 2);
+        break;
+      case CtxsLimitPolicy::freeze:
+        ctxInfo.freeze();
+        break;
+    }
+  }
+  lastWords_.add(ord);
+  ctxInfo.update(ord);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class DictT, typename OrdT, std::uint16_t maxCtxLength>
+void CtxBase<DictT, OrdT, maxCtxLength>::resetCtxs_() {
+  auto& ctxInfo = static_cast<DictT*>(this)->ctxInfo_;
+  ctxInfo.reset();
+  for (const auto ord : lastWords_.getCtx()) {
+    ctxInfo.update(ord);
   }
 }
 
@@ -70,4 +157,4 @@ auto CtxBase<DictT, OrdT, maxCtxLength>::getSearchCtxEmptySkipped_() const
 
 }  // namespace ael::impl::dict
 
-#endif
\ No newline at end of file
+#endif
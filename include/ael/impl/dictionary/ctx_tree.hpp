@@ -0,0 +1,331 @@
+#ifndef AEL_IMPL_DICT_CTX_TREE_HPP
+#define AEL_IMPL_DICT_CTX_TREE_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ael::impl::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The CtxLinks class.
+///
+/// Shape of a context tree. A node is a context of the last `length` words.
+/// Its suffix link leads to the context without the oldest word, so walking
+/// from the longest context to the shortest one is hopping by suffix links.
+/// Its successor by a word is the context after this word, so moving to the
+/// next context is one lookup of a (node, word) pair.
+///
+/// Nodes are numbered in order of creation, so a suffix or a prefix of a
+/// node has a smaller number than the node itself.
+///
+/// Tree memory is allocated from a pool owned by the tree. Context cells
+/// should be allocated from it too (see `getResource`), so that a model does
+/// not go to the global allocator for each small map node, and all of its
+/// memory is returned upstream at once on reset or destruction.
+///
+class CtxLinks {
+ public:
+  using Ord = std::uint64_t;
+  using Node = std::uint32_t;
+
+  /// Node of the empty context.
+  constexpr static Node root = 0;
+  /// Number of a removed node.
+  constexpr static Node noNode = std::numeric_limits<Node>::max();
+
+ public:
+  CtxLinks() = delete;
+
+  /**
+   * @brief CtxLinks constructor.
+   * @param ctxLength - maximal context length.
+   */
+  explicit CtxLinks(std::size_t ctxLength);
+
+  /**
+   * @brief update - move to the context after a word.
+   * @param ord - order of a word.
+   */
+  void update(Ord ord);
+
+  /**
+   * @brief reset - drop all contexts except the empty one and return pool
+   * memory upstream. Memory allocated from `getResource` must be freed
+   * before.
+   */
+  void reset();
+
+  /**
+   * @brief freeze - stop creating contexts. Update moves to the longest met
+   * suffix of the next context.
+   */
+  void freeze() {
+    frozen_ = true;
+  }
+
+  /**
+   * @brief getCurrNode - context of the last `ctxLength` words (or fewer,
+   * if fewer words were met).
+   * @return context node.
+   */
+  [[nodiscard]] Node getCurrNode() const {
+    return currNode_;
+  }
+
+  /**
+   * @brief getSuffix - context without the oldest word.
+   * @param node - not root context node.
+   * @return suffix context node.
+   */
+  [[nodiscard]] Node getSuffix(Node node) const {
+    assert(node != root && "Empty context has no suffix.");
+    return nodes_[node].suffix;
+  }
+
+  /**
+   * @brief getLength - number of words in a context.
+   * @param node - context node.
+   * @return context length.
+   */
+  [[nodiscard]] std::size_t getLength(Node node) const {
+    return nodes_[node].length;
+  }
+
+  /**
+   * @brief getNodesCnt - number of created contexts including the empty one.
+   * @return nodes count.
+   */
+  [[nodiscard]] std::size_t getNodesCnt() const {
+    return nodes_.size();
+  }
+
+  /**
+   * @brief getResource - memory pool of the tree.
+   * @return memory resource, which lives as long as the tree.
+   */
+  [[nodiscard]] std::pmr::memory_resource* getResource() const {
+    return resource_.get();
+  }
+
+ protected:
+  /**
+   * @brief prune_ - remove rarely met contexts. A context is removed, if it
+   * was met less times than a threshold, or if its suffix or prefix is
+   * removed. The threshold is doubled, until at most `maxNodesCnt` nodes are
+   * left, so long contexts go first. Meet counts of left nodes are halved.
+   * @param maxNodesCnt - maximal number of left nodes, at least 1.
+   * @return new numbers of old nodes or `noNode` for removed ones.
+   */
+  std::vector<Node> prune_(std::size_t maxNodesCnt);
+
+ private:
+  struct Node_ {
+    Node suffix;
+    // Context without the newest word.
+    Node prefix;
+    std::uint16_t length;
+    // Number of times this context was the longest current one.
+    std::uint32_t hits;
+  };
+
+  struct SuccessorKey_ {
+    Node node;
+    Ord ord;
+    friend bool operator==(SuccessorKey_, SuccessorKey_) = default;
+  };
+
+  struct SuccessorKeyHash_ {
+    std::size_t operator()(SuccessorKey_ key) const {
+      constexpr auto mul = std::size_t{0x9E3779B97F4A7C15ULL};
+      return static_cast<std::size_t>(key.ord) ^ (std::size_t{key.node} * mul);
+    }
+  };
+
+ private:
+  Node getSuccessor_(Node node, Ord ord);
+
+  [[nodiscard]] Node findSuccessor_(Node node, Ord ord) const;
+
+  [[nodiscard]] std::vector<std::uint64_t> getMetCnts_() const;
+
+ private:
+  using Successors_ =
+      std::pmr::unordered_map<SuccessorKey_, Node, SuccessorKeyHash_>;
+
+ private:
+  // Pool is declared first to outlive nodes and cells.
+  std::unique_ptr<std::pmr::unsynchronized_pool_resource> resource_{
+      std::make_unique<std::pmr::unsynchronized_pool_resource>()};
+  std::pmr::vector<Node_> nodes_{{Node_{root, root, 0, 0}}, resource_.get()};
+  // Successors of contexts, which are shorter than `ctxLength_`. Successor of
+  // a full context is the successor of its suffix.
+  Successors_ successors_{resource_.get()};
+  const std::size_t ctxLength_;
+  Node currNode_{root};
+  bool frozen_{false};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The CtxCursor class.
+///
+/// A context in a context tree. It has the interface of a sequence of words
+/// from the newest to the oldest one: `pop_back` drops the oldest word by a
+/// suffix link.
+///
+class CtxCursor {
+ public:
+  using Node = CtxLinks::Node;
+
+ public:
+  CtxCursor(const CtxLinks& links, Node node) : links_{&links}, node_{node} {
+  }
+
+  [[nodiscard]] Node getNode() const {
+    return node_;
+  }
+
+  [[nodiscard]] bool empty() const {
+    return node_ == CtxLinks::root;
+  }
+
+  [[nodiscard]] std::size_t size() const {
+    return links_->getLength(node_);
+  }
+
+  void pop_back() {
+    node_ = links_->getSuffix(node_);
+  }
+
+  void resize(std::size_t length) {
+    assert(length <= size() && "Context can only be shortened.");
+    for (auto i = size(); i > length; --i) {
+      pop_back();
+    }
+  }
+
+ private:
+  const CtxLinks* links_;
+  Node node_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The CtxTree<CellT> class.
+///
+/// Context tree with statistics cells. Nodes are created, when a context is
+/// passed, and cells, when a word is counted in a context, so a node without
+/// a cell is a context, which was not met before.
+///
+template <class CellT>
+class CtxTree : public CtxLinks {
+ public:
+  CtxTree() = delete;
+
+  /**
+   * @brief CtxTree constructor.
+   * @param ctxLength - maximal context length.
+   */
+  explicit CtxTree(std::size_t ctxLength)
+      : CtxLinks(ctxLength),
+        cells_(std::in_place, getNodesCnt(), getResource()) {
+  }
+
+  /**
+   * @brief update - move to the context after a word.
+   * @param ord - order of a word.
+   */
+  void update(Ord ord) {
+    CtxLinks::update(ord);
+    cells_->resize(getNodesCnt());
+  }
+
+  /**
+   * @brief reset - drop all contexts and their cells.
+   */
+  void reset() {
+    cells_.reset();
+    CtxLinks::reset();
+    cells_.emplace(getNodesCnt(), getResource());
+  }
+
+  /**
+   * @brief prune - remove rarely met contexts with their cells.
+   * @param maxNodesCnt - maximal number of left contexts, at least 1.
+   */
+  void prune(std::size_t maxNodesCnt);
+
+  /**
+   * @brief getCurrCtx - context of the last `ctxLength` words.
+   * @return context cursor.
+   */
+  [[nodiscard]] CtxCursor getCurrCtx() const {
+    return {*this, getCurrNode()};
+  }
+
+  [[nodiscard]] bool contains(const CtxCursor& ctx) const {
+    return (*cells_)[ctx.getNode()].has_value();
+  }
+
+  [[nodiscard]] const CellT& at(const CtxCursor& ctx) const {
+    assert(contains(ctx) && "Context has no cell.");
+    return *(*cells_)[ctx.getNode()];
+  }
+
+  [[nodiscard]] CellT& at(const CtxCursor& ctx) {
+    assert(contains(ctx) && "Context has no cell.");
+    return *(*cells_)[ctx.getNode()];
+  }
+
+  /**
+   * @brief emplace - create a cell of a context, which has no cell.
+   * @param ctx - context.
+   * @param args - cell constructor arguments.
+   * @return created cell.
+   */
+  template <class... ArgsT>
+  CellT& emplace(const CtxCursor& ctx, ArgsT&&... args) {
+    assert(!contains(ctx) && "Context already has a cell.");
+    return (*cells_)[ctx.getNode()].emplace(std::forward<ArgsT>(args)...);
+  }
+
+ private:
+  // Deque keeps cells in place, when nodes are added.
+  using Cells_ = std::pmr::deque<std::optional<CellT>>;
+
+ private:
+  // Optional to destroy the deque with its storage, before the pool is
+  // released on reset.
+  std::optional<Cells_> cells_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+template <class CellT>
+void CtxTree<CellT>::prune(std::size_t maxNodesCnt) {
+  const auto newNodes = prune_(maxNodesCnt);
+  auto& cells = *cells_;
+  // New numbers keep the order of old ones, so cells move only down.
+  for (std::size_t node = 0; node < newNodes.size(); ++node) {
+    const auto newNode = newNodes[node];
+    if (newNode == noNode || newNode == node) {
+      continue;
+    }
+    auto& cell = cells[newNode];
+    cell.reset();
+    if (cells[node].has_value()) {
+      cell.emplace(std::move(*cells[node]));
+    }
+  }
+  cells.resize(getNodesCnt());
+}
+
+}  // namespace ael::impl::dict
+
+#endif  // AEL_IMPL_DICT_CTX_TREE_HPP
@@ -0,0 +1,141 @@
+#ifndef AEL_IMPL_DICT_CUMULATIVE_REAL_UNIQUE_COUNT_HPP
+#define AEL_IMPL_DICT_CUMULATIVE_REAL_UNIQUE_COUNT_HPP
+
+#include <ael/impl/dictionary/counts_options.hpp>
+#include <ael/impl/dictionary/fenwick_tree.hpp>
+#include <cstdint>
+#include <memory_resource>
+
+namespace ael::impl::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The CumulativeRealUniqueCount class.
+///
+/// Real and unique counts of words in one Fenwick tree, which nodes keep both
+/// sums. So an update, a prefix query or a search probe touches one node for
+/// both counts. Real counts are only increased or halved rounding up, so a
+/// word is met exactly when its real count is not zero.
+///
+class CumulativeRealUniqueCount {
+ public:
+  using Ord = std::uint64_t;
+  using Count = std::uint64_t;
+
+  struct Counts {
+    Count real;
+    Count unique;
+
+    Counts& operator+=(const Counts& other) {
+      real += other.real;
+      unique += other.unique;
+      return *this;
+    }
+
+    Counts& operator-=(const Counts& other) {
+      real -= other.real;
+      unique -= other.unique;
+      return *this;
+    }
+
+    friend bool operator==(const Counts&, const Counts&) = default;
+  };
+
+ public:
+  CumulativeRealUniqueCount() = delete;
+
+  /**
+   * @brief CumulativeRealUniqueCount constructor.
+   * @param maxOrd - maximal order.
+   * @param layout - counts storage layout.
+   * @param rescaleThreshold - real total words count, exceeding which halves
+   * real counts of all words.
+   * @param resource - memory resource of counts storage.
+   */
+  explicit CumulativeRealUniqueCount(
+      Ord maxOrd, CountsLayout layout = CountsLayout::automatic,
+      Count rescaleThreshold = noRescale,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+  /**
+   * @brief increaseOrdCount - increase real count of a word, mark it met and
+   * rescale real counts, if real total words count exceeds rescale threshold.
+   * @param ord - order index of a word.
+   * @param cnt - positive count increase.
+   */
+  void increaseOrdCount(Ord ord, Count cnt);
+
+  /**
+   * @brief halveCounts - divide real counts by two rounding up. Unique counts
+   * are not changed.
+   */
+  void halveCounts();
+
+  /**
+   * @brief getLowerCumulativeCnts - real and unique counts of ords [0, ord).
+   * @param ord - order index of a word.
+   * @return lower cumulative counts.
+   */
+  [[nodiscard]] Counts getLowerCumulativeCnts(Ord ord) const {
+    return cnts_.getLowerCumulativeCnt(ord);
+  }
+
+  /**
+   * @brief getRealCount - real count of one word.
+   * @param ord - order index of a word.
+   * @return real word count.
+   */
+  [[nodiscard]] Count getRealCount(Ord ord) const {
+    return cnts_.getCount(ord).real;
+  }
+
+  /**
+   * @brief getNodeCnts - counts of ords [pos - lowbit(pos), pos).
+   * @param pos - node index in (0, maxOrd].
+   * @return node counts.
+   */
+  [[nodiscard]] Counts getNodeCnts(Ord pos) const {
+    return cnts_.getNodeCnt(pos);
+  }
+
+  /**
+   * @brief getSearchStep - first step of binary lifting search.
+   * @return greatest power of two, which is not greater than maxOrd.
+   */
+  [[nodiscard]] Ord getSearchStep() const {
+    return cnts_.getSearchStep();
+  }
+
+  /**
+   * @brief getRealTotalWordsCnt - sum of real counts.
+   * @return real total words count.
+   */
+  [[nodiscard]] Count getRealTotalWordsCnt() const {
+    return realTotalWordsCnt_;
+  }
+
+  /**
+   * @brief getUniqueTotalWordsCnt - number of met words.
+   * @return unique total words count.
+   */
+  [[nodiscard]] Count getUniqueTotalWordsCnt() const {
+    return uniqueTotalWordsCnt_;
+  }
+
+  /**
+   * @brief getNthUnmetOrd - select a word, which was not met yet.
+   * @param num - index of a word among not met ones.
+   * @return word ord.
+   */
+  [[nodiscard]] Ord getNthUnmetOrd(Count num) const;
+
+ private:
+  FenwickTree<Counts> cnts_;
+  Count realTotalWordsCnt_{0};
+  Count uniqueTotalWordsCnt_{0};
+  const Count rescaleThreshold_;
+  const Ord maxOrd_;
+};
+
+}  // namespace ael::impl::dict
+
+#endif  // AEL_IMPL_DICT_CUMULATIVE_REAL_UNIQUE_COUNT_HPP
@@ -0,0 +1,76 @@
+#ifndef AEL_IMPL_DICT_DECODED_WORD_HPP
+#define AEL_IMPL_DICT_DECODED_WORD_HPP
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+
+namespace ael::impl::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Decoded word with its probability stats.
+///
+template <class CountT>
+struct DecodedWord {
+  std::uint64_t ord;
+  CountT low;
+  CountT high;
+  CountT total;
+};
+
+/**
+ * @brief findWord - find a word, which cumulative counts interval contains
+ * target. Cumulative counts of search interval borders are kept, so word
+ * probability stats come with the search.
+ * @param maxOrd - number of words.
+ * @param total - total words count. It may exceed lower cumulative count of
+ * `maxOrd`, when part of it is reserved (for example, for an escape).
+ * @param target - cumulative count to search.
+ * @param getLowerCnt - lower cumulative count getter.
+ * @return found word and its probability stats.
+ */
+template <class CountT, class GetLowerCntT>
+DecodedWord<CountT> findWord(std::uint64_t maxOrd, CountT total,
+                             const CountT& target, GetLowerCntT getLowerCnt) {
+  auto left = std::uint64_t{0};
+  auto right = maxOrd;
+  auto leftCnt = CountT{0};
+  auto rightCnt = getLowerCnt(maxOrd);
+  assert(target < rightCnt && rightCnt <= total);
+  // Invariant: getLowerCnt(left) <= target < getLowerCnt(right).
+  while (right - left > 1) {
+    const auto mid = left + (right - left) / 2;
+    if (auto midCnt = getLowerCnt(mid); midCnt <= target) {
+      left = mid;
+      leftCnt = std::move(midCnt);
+    } else {
+      right = mid;
+      rightCnt = std::move(midCnt);
+    }
+  }
+  return {left, std::move(leftCnt), std::move(rightCnt), std::move(total)};
+}
+
+/**
+ * @brief decodeWord - decode a word by target cumulative count and update
+ * dictionary. Uses `dict.decodeSymbol(target)` if dictionary has it,
+ * otherwise `getWordOrd` and `getProbabilityStats`.
+ * @param dict - dictionary.
+ * @param target - cumulative count.
+ * @return decoded word and its probability stats.
+ */
+template <class DictT>
+DecodedWord<typename DictT::Count> decodeWord(
+    DictT& dict, const typename DictT::Count& target) {
+  if constexpr (requires { dict.decodeSymbol(target); }) {
+    return dict.decodeSymbol(target);
+  } else {
+    const auto ord = dict.getWordOrd(target);
+    auto [low, high, total] = dict.getProbabilityStats(ord);
+    return {ord, std::move(low), std::move(high), std::move(total)};
+  }
+}
+
+}  // namespace ael::impl::dict
+
+#endif  // AEL_IMPL_DICT_DECODED_WORD_HPP
@@ -0,0 +1,219 @@
+#ifndef AEL_IMPL_DICT_FENWICK_TREE_HPP
+#define AEL_IMPL_DICT_FENWICK_TREE_HPP
+
+#include <ael/impl/dictionary/counts_options.hpp>
+#include <bit>
+#include <cstdint>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+namespace ael::impl::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The FenwickTree class.
+///
+/// Point update, prefix sum tree over ords [0, maxOrd). Node `i` (1-based)
+/// keeps sum of counts of ords [i - lowbit(i), i). Counts of single ords are
+/// kept too.
+///
+/// A count is a number or a struct of several counts, which are summed
+/// together (like real and unique counts). It needs `+=`, `-=` and `==`, and
+/// `Count{}` is zero.
+///
+/// Nodes are visible to make binary lifting search over several trees of the
+/// same size at once: node `getSearchStep()` and then nodes `pos + step` for
+/// halved steps.
+///
+/// Storage is allocated from a memory resource, so that many small trees of
+/// one model can share an arena.
+///
+template <class CountT>
+class FenwickTree {
+ public:
+  using Ord = std::uint64_t;
+  using Count = CountT;
+
+  /// Greatest alphabet size, for which dense layout is chosen automatically.
+  constexpr static Ord denseMaxOrd = Ord{1} << 20;
+
+ public:
+  FenwickTree() = delete;
+
+  /**
+   * @brief FenwickTree constructor.
+   * @param maxOrd - maximal order.
+   * @param layout - counts storage layout.
+   * @param resource - memory resource of counts storage.
+   */
+  explicit FenwickTree(
+      Ord maxOrd, CountsLayout layout = CountsLayout::automatic,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+  /**
+   * @brief update - change count of one ord.
+   * @param ord - order index of a word.
+   * @param cntChange - count change. Unsigned counts are decreased by
+   * wrapping around.
+   */
+  void update(Ord ord, const Count& cntChange);
+
+  /**
+   * @brief changeCounts - decrease counts of all ords at once. Dense tree is
+   * rebuilt in linear time.
+   * @param decrease - function, which decreases a count in place and returns
+   * the decrease. Dense tree passes zero counts too.
+   * @return total count decrease.
+   */
+  template <class DecreaseF>
+  Count changeCounts(DecreaseF decrease);
+
+  /**
+   * @brief halveCounts - divide all counts by two rounding up, so that
+   * nonzero counts stay nonzero.
+   * @return total count decrease.
+   */
+  Count halveCounts() {
+    return changeCounts([](Count& cnt) {
+      const auto decrease = cnt / 2;
+      cnt -= decrease;
+      return decrease;
+    });
+  }
+
+  /**
+   * @brief getLowerCumulativeCnt - sum of counts of ords [0, ord).
+   * @param ord - order index of a word.
+   * @return lower cumulative count.
+   */
+  [[nodiscard]] Count getLowerCumulativeCnt(Ord ord) const;
+
+  /**
+   * @brief getCount - count of one ord.
+   * @param ord - order index of a word.
+   * @return word count.
+   */
+  [[nodiscard]] Count getCount(Ord ord) const {
+    return dense_ ? denseCnts_[ord] : getSparse_(sparseCnts_, ord);
+  }
+
+  /**
+   * @brief getNodeCnt - sum of counts of ords [pos - lowbit(pos), pos).
+   * @param pos - node index in (0, maxOrd].
+   * @return node count.
+   */
+  [[nodiscard]] Count getNodeCnt(Ord pos) const {
+    return dense_ ? denseNodes_[pos] : getSparse_(sparseNodes_, pos);
+  }
+
+  /**
+   * @brief getSearchStep - first step of binary lifting search.
+   * @return greatest power of two, which is not greater than maxOrd.
+   */
+  [[nodiscard]] Ord getSearchStep() const {
+    return std::bit_floor(maxOrd_);
+  }
+
+ private:
+  using SparseMap_ = std::pmr::unordered_map<Ord, Count>;
+
+ private:
+  void updateNodes_(Ord ord, const Count& cntChange);
+
+  static Count getSparse_(const SparseMap_& values, Ord key) {
+    const auto valueIt = values.find(key);
+    return valueIt == values.end() ? Count{} : valueIt->second;
+  }
+
+ private:
+  std::pmr::vector<Count> denseNodes_;
+  std::pmr::vector<Count> denseCnts_;
+  SparseMap_ sparseNodes_;
+  SparseMap_ sparseCnts_;
+  Ord maxOrd_;
+  bool dense_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+template <class CountT>
+FenwickTree<CountT>::FenwickTree(Ord maxOrd, CountsLayout layout,
+                                 std::pmr::memory_resource* resource)
+    : denseNodes_(resource),
+      denseCnts_(resource),
+      sparseNodes_(resource),
+      sparseCnts_(resource),
+      maxOrd_{maxOrd},
+      dense_{layout == CountsLayout::dense ||
+             (layout == CountsLayout::automatic && maxOrd <= denseMaxOrd)} {
+  if (dense_) {
+    denseNodes_.resize(maxOrd + 1, Count{});
+    denseCnts_.resize(maxOrd, Count{});
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class CountT>
+void FenwickTree<CountT>::update(Ord ord, const Count& cntChange) {
+  if (dense_) {
+    denseCnts_[ord] += cntChange;
+  } else {
+    sparseCnts_[ord] += cntChange;
+  }
+  updateNodes_(ord, cntChange);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class CountT>
+template <class DecreaseF>
+auto FenwickTree<CountT>::changeCounts(DecreaseF decrease) -> Count {
+  auto ret = Count{};
+  if (!dense_) {
+    for (auto& [ord, cnt] : sparseCnts_) {
+      if (const Count cntDecrease = decrease(cnt); cntDecrease != Count{}) {
+        ret += cntDecrease;
+        auto cntChange = Count{};
+        cntChange -= cntDecrease;
+        updateNodes_(ord, cntChange);
+      }
+    }
+    return ret;
+  }
+  // All nodes change, so the tree is rebuilt in linear time.
+  for (Ord pos = 1; pos <= maxOrd_; ++pos) {
+    auto& cnt = denseCnts_[pos - 1];
+    ret += decrease(cnt);
+    denseNodes_[pos] = cnt;
+  }
+  for (Ord pos = 1; pos <= maxOrd_; ++pos) {
+    if (const auto parent = pos + (pos & (~pos + 1)); parent <= maxOrd_) {
+      denseNodes_[parent] += denseNodes_[pos];
+    }
+  }
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class CountT>
+auto FenwickTree<CountT>::getLowerCumulativeCnt(Ord ord) const -> Count {
+  auto ret = Count{};
+  for (auto pos = ord; pos != 0; pos &= pos - 1) {
+    ret += getNodeCnt(pos);
+  }
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class CountT>
+void FenwickTree<CountT>::updateNodes_(Ord ord, const Count& cntChange) {
+  for (auto pos = ord + 1; pos <= maxOrd_; pos += pos & (~pos + 1)) {
+    if (dense_) {
+      denseNodes_[pos] += cntChange;
+    } else {
+      sparseNodes_[pos] += cntChange;
+    }
+  }
+}
+
+}  // namespace ael::impl::dict
+
+#endif  // AEL_IMPL_DICT_FENWICK_TREE_HPP
@@ -0,0 +1,111 @@
+#ifndef AEL_IMPL_DICT_NARROW_A_D_DICTIONARY_BASE_HPP
+#define AEL_IMPL_DICT_NARROW_A_D_DICTIONARY_BASE_HPP
+
+#include <ael/impl/dictionary/decoded_word.hpp>
+#include <ael/impl/dictionary/word_probability_stats.hpp>
+#include <cstdint>
+#include <stdexcept>
+
+namespace ael::impl::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The NarrowADDictionaryBase<InternalDictT> class.
+///
+/// Adaptive A/D dictionary for small alphabets with 32-bit counts. Real
+/// counts are halved every time model total words count exceeds
+/// `maxTotalWordsCnt`, so the coder may work with 31-bit ranges and native
+/// 64-bit products.
+///
+template <class InternalDictT>
+class NarrowADDictionaryBase : protected InternalDictT {
+ public:
+  using Ord = std::uint64_t;
+  using Count = std::uint32_t;
+  using ProbabilityStats = WordProbabilityStats<Count>;
+  using DecodedWord = ael::impl::dict::DecodedWord<Count>;
+  constexpr const static std::uint16_t countNumBits = 31;
+  constexpr const static Count maxTotalWordsCnt = Count{1} << 16;
+  constexpr const static Ord maxMaxOrd = 256;
+
+ public:
+  NarrowADDictionaryBase() = delete;
+
+  /**
+   * @brief Narrow dictionary constructor.
+   * @param maxOrd - maximal order. Must not be bigger than `maxMaxOrd`.
+   */
+  explicit NarrowADDictionaryBase(Ord maxOrd);
+
+  /**
+   * @brief getWordOrd - get word order index by cumulative count.
+   * @param cumulativeCnt - search key.
+   * @return word with exact cumulative number found.
+   */
+  [[nodiscard]] Ord getWordOrd(Count cumulativeCnt) const {
+    return InternalDictT::getWordOrd(cumulativeCnt);
+  }
+
+  /**
+   * @brief getProbabilityStats - get probability stats, update and rescale.
+   * @param ord - order of a word.
+   * @return [low, high, total]
+   */
+  [[nodiscard]] ProbabilityStats getProbabilityStats(Ord ord);
+
+  /**
+   * @brief decodeSymbol - find a word by cumulative count, get its
+   * probability stats, update and rescale.
+   * @param cumulativeCnt - search key.
+   * @return [ord, low, high, total]
+   */
+  [[nodiscard]] DecodedWord decodeSymbol(Count cumulativeCnt);
+
+  /**
+   * @brief getTotalWordsCnt - get total words count estimation.
+   * @return total words count estimation, not bigger than
+   * `maxTotalWordsCnt`.
+   */
+  [[nodiscard]] Count getTotalWordsCnt() const {
+    return static_cast<Count>(InternalDictT::getTotalWordsCnt());
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+template <class InternalDictT>
+NarrowADDictionaryBase<InternalDictT>::NarrowADDictionaryBase(Ord maxOrd)
+    : InternalDictT(maxOrd) {
+  if (maxOrd > maxMaxOrd) {
+    throw std::invalid_argument("Too big alphabet for a narrow dictionary.");
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class InternalDictT>
+auto NarrowADDictionaryBase<InternalDictT>::getProbabilityStats(Ord ord)
+    -> ProbabilityStats {
+  const auto [low, high, total] = InternalDictT::getProbabilityStats(ord);
+  // Counts of met words never go below one, so for alphabets up to
+  // `maxMaxOrd` words the loop ends.
+  while (InternalDictT::getTotalWordsCnt() > maxTotalWordsCnt) {
+    this->halveWordsCnts_();
+  }
+  return {static_cast<Count>(low), static_cast<Count>(high),
+          static_cast<Count>(total)};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class InternalDictT>
+auto NarrowADDictionaryBase<InternalDictT>::decodeSymbol(Count cumulativeCnt)
+    -> DecodedWord {
+  const auto [ord, low, high, total] =
+      InternalDictT::decodeSymbol(cumulativeCnt);
+  while (InternalDictT::getTotalWordsCnt() > maxTotalWordsCnt) {
+    this->halveWordsCnts_();
+  }
+  return {ord, static_cast<Count>(low), static_cast<Count>(high),
+          static_cast<Count>(total)};
+}
+
+}  // namespace ael::impl::dict
+
+#endif  // AEL_IMPL_DICT_NARROW_A_D_DICTIONARY_BASE_HPP
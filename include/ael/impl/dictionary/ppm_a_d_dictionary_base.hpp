@@ -1,8 +1,11 @@
 #ifndef AEL_IMPL_DICT_PPM_A_D_DICTIONARY_BASE_HPP
 #define AEL_IMPL_DICT_PPM_A_D_DICTIONARY_BASE_HPP
 
+#include <ael/impl/dictionary/counts_options.hpp>
 #include <ael/impl/dictionary/ctx_base.hpp>
 #include <ael/impl/dictionary/max_ord_base.hpp>
+#include <algorithm>
+#include <bit>
 #include <cstdint>
 
 namespace ael::impl::dict {
@@ -15,6 +18,7 @@ class PPMADDictionaryBase : protected MaxOrdBase<std::uint64_t>,
                             protected CtxBase<DictT, std::uint64_t, maxCtxLength> {
  public:
   using Ord = MaxOrdBase::Ord;
+  using Count = std::uint64_t;
 
  protected:
   using SearchCtx_ = CtxBase<DictT, std::uint64_t, maxCtxLength>::SearchCtx_;
@@ -23,9 +27,46 @@ class PPMADDictionaryBase : protected MaxOrdBase<std::uint64_t>,
   PPMADDictionaryBase() = delete;
 
  protected:
-  explicit PPMADDictionaryBase(Ord maxOrd, std::size_t ctxLength)
-      : MaxOrdBase(maxOrd), CtxBase<DictT, std::uint64_t, maxCtxLength>(ctxLength) {
+  /**
+   * @brief PPMADDictionaryBase constructor.
+   *
+   * @param maxOrd maximal order.
+   * @param ctxLength context length.
+   * @param rescaleThreshold total words count of a context, exceeding which
+   * halves all counts of this context.
+   * @param maxCtxsCnt maximal number of contexts.
+   * @param ctxsLimitPolicy what to do, when contexts limit is reached.
+   */
+  PPMADDictionaryBase(
+      Ord maxOrd, std::size_t ctxLength, Count rescaleThreshold = noRescale,
+      std::size_t maxCtxsCnt = noCtxsLimit,
+      CtxsLimitPolicy ctxsLimitPolicy = CtxsLimitPolicy::restart)
+      : MaxOrdBase(maxOrd),
+        CtxBase<DictT, std::uint64_t, maxCtxLength>(ctxLength, maxCtxsCnt,
+                                                    ctxsLimitPolicy),
+        rescaleThreshold_{rescaleThreshold} {
   }
+
+  [[nodiscard]] Count getRescaleThreshold_() const {
+    return rescaleThreshold_;
+  }
+
+  /**
+   * @brief log2 of a context total words count bound. Without rescaling it
+   * is a sequence length bound.
+   *
+   * @param maxSeqLenLog2 log2 of maximal sequence length.
+   * @return bits in a context total words count.
+   */
+  [[nodiscard]] std::uint16_t getCtxTotalCntLog2_(
+      std::uint16_t maxSeqLenLog2) const {
+    const auto thresholdLog2 =
+        static_cast<std::uint16_t>(std::bit_width(rescaleThreshold_));
+    return std::min(maxSeqLenLog2, thresholdLog2);
+  }
+
+ private:
+  const Count rescaleThreshold_;
 };
 
 }  // namespace ael::impl::dict
@@ -0,0 +1,170 @@
+#ifndef AEL_IMPL_DICT_SMALL_ADAPTIVE_DICTIONARY_BASE_HPP
+#define AEL_IMPL_DICT_SMALL_ADAPTIVE_DICTIONARY_BASE_HPP
+
+#include <ael/impl/dictionary/counts_options.hpp>
+#include <ael/impl/dictionary/decoded_word.hpp>
+#include <ael/impl/dictionary/small_alphabet_counts.hpp>
+#include <ael/impl/dictionary/word_probability_stats.hpp>
+#include <array>
+#include <cstdint>
+
+namespace ael::impl::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The SmallAdaptiveDictionaryBase class.
+///
+/// Adaptive dictionary over a compile-time sized alphabet. Counts are kept in
+/// flat arrays. Model is set by DerivedT: `getLowerCntCoefs_()` returns
+/// LowerCntCoefs of model lower cumulative counts. They may change only with
+/// real total or unique total words count.
+///
+/// Real counts are halved rounding up, when real total words count exceeds
+/// a rescale threshold, so met words stay met.
+///
+template <std::uint64_t maxOrd, class DerivedT>
+class SmallAdaptiveDictionaryBase {
+ public:
+  using Ord = std::uint64_t;
+  using Count = std::uint64_t;
+  using ProbabilityStats = WordProbabilityStats<Count>;
+  using DecodedWord = impl::dict::DecodedWord<Count>;
+  constexpr const static std::uint16_t countNumBits = 62;
+
+  static_assert(maxOrd != 0, "Empty alphabet.");
+  static_assert(maxOrd <= (Ord{1} << 16), "Alphabet is too big.");
+
+ public:
+  /**
+   * @brief getWordOrd - get word order index by cumulative count.
+   * @param cumulativeCnt - search key.
+   * @return word with exact cumulative number found.
+   */
+  [[nodiscard]] Ord getWordOrd(Count cumulativeCnt) const {
+    return lowerCnts_.findWord(cumulativeCnt);
+  }
+
+  /**
+   * @brief getProbabilityStats - get probability stats and update.
+   * @param ord - order of a word.
+   * @return [low, high, total]
+   */
+  [[nodiscard]] ProbabilityStats getProbabilityStats(Ord ord);
+
+  /**
+   * @brief decodeSymbol - find a word by cumulative count, get its
+   * probability stats and update.
+   * @param cumulativeCnt - search key.
+   * @return [ord, low, high, total]
+   */
+  [[nodiscard]] DecodedWord decodeSymbol(Count cumulativeCnt);
+
+  /**
+   * @brief getTotalWordsCnt - get total words count estimation.
+   * @return total words count estimation.
+   */
+  [[nodiscard]] Count getTotalWordsCnt() const {
+    return lowerCnts_.getLowerCnt(maxOrd);
+  }
+
+ protected:
+  /**
+   * @brief SmallAdaptiveDictionaryBase constructor.
+   * @param rescaleThreshold - real total words count, exceeding which halves
+   * real counts of all words.
+   */
+  explicit SmallAdaptiveDictionaryBase(Count rescaleThreshold)
+      : rescaleThreshold_{rescaleThreshold} {
+  }
+
+  [[nodiscard]] Count getRealTotalWordsCnt_() const {
+    return wordsCnt_;
+  }
+
+  [[nodiscard]] Count getTotalWordsUniqueCnt_() const {
+    return uniqueWordsCnt_;
+  }
+
+  /**
+   * @brief recalculate model lower cumulative counts of all words.
+   */
+  void recalcLowerCnts_();
+
+ private:
+  void updateWordCnt_(Ord ord);
+
+  void halveWordCnts_();
+
+ private:
+  SmallAlphabetCounts<maxOrd> lowerCnts_;
+  alignas(32) typename SmallAlphabetCounts<maxOrd>::WordCnts wordCnts_{};
+  Count wordsCnt_{0};
+  Count uniqueWordsCnt_{0};
+  const Count rescaleThreshold_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+template <std::uint64_t maxOrd, class DerivedT>
+auto SmallAdaptiveDictionaryBase<maxOrd, DerivedT>::getProbabilityStats(
+    Ord ord) -> ProbabilityStats {
+  const auto ret = ProbabilityStats{lowerCnts_.getLowerCnt(ord),
+                                    lowerCnts_.getLowerCnt(ord + 1),
+                                    getTotalWordsCnt()};
+  updateWordCnt_(ord);
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <std::uint64_t maxOrd, class DerivedT>
+auto SmallAdaptiveDictionaryBase<maxOrd, DerivedT>::decodeSymbol(
+    Count cumulativeCnt) -> DecodedWord {
+  const auto ord = lowerCnts_.findWord(cumulativeCnt);
+  const auto ret =
+      DecodedWord{ord, lowerCnts_.getLowerCnt(ord),
+                  lowerCnts_.getLowerCnt(ord + 1), getTotalWordsCnt()};
+  updateWordCnt_(ord);
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <std::uint64_t maxOrd, class DerivedT>
+void SmallAdaptiveDictionaryBase<maxOrd, DerivedT>::recalcLowerCnts_() {
+  lowerCnts_.recalc(wordCnts_,
+                    static_cast<const DerivedT&>(*this).getLowerCntCoefs_());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <std::uint64_t maxOrd, class DerivedT>
+void SmallAdaptiveDictionaryBase<maxOrd, DerivedT>::updateWordCnt_(Ord ord) {
+  const auto isNew = wordCnts_[ord] == 0;
+  ++wordCnts_[ord];
+  ++wordsCnt_;
+  uniqueWordsCnt_ += isNew ? 1 : 0;
+  if (wordsCnt_ > rescaleThreshold_) {
+    halveWordCnts_();
+    recalcLowerCnts_();
+    return;
+  }
+  if (isNew) {
+    // Model of all words changes with unique words count.
+    recalcLowerCnts_();
+    return;
+  }
+  // Only real lower counts after the word change, each by one.
+  lowerCnts_.increaseAfter(
+      ord, static_cast<const DerivedT&>(*this).getLowerCntCoefs_().realMul);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <std::uint64_t maxOrd, class DerivedT>
+void SmallAdaptiveDictionaryBase<maxOrd, DerivedT>::halveWordCnts_() {
+  // Padding counts are zeros and stay zeros.
+  wordsCnt_ = 0;
+  for (auto& cnt : wordCnts_) {
+    cnt -= cnt / 2;
+    wordsCnt_ += cnt;
+  }
+}
+
+}  // namespace ael::impl::dict
+
+#endif  // AEL_IMPL_DICT_SMALL_ADAPTIVE_DICTIONARY_BASE_HPP
@@ -0,0 +1,197 @@
+#ifndef AEL_IMPL_DICT_SMALL_ALPHABET_COUNTS_HPP
+#define AEL_IMPL_DICT_SMALL_ALPHABET_COUNTS_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#if defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>
+#endif
+
+namespace ael::impl::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The LowerCntCoefs class.
+///
+/// Model lower cumulative count of a word as a linear function of its order
+/// and of real and unique lower cumulative counts:
+/// `realMul * realLower + ordMul * ord + uniqueMul * uniqueLower`. It is
+/// calculated modulo 2^64, so a coefficient may be negative.
+///
+struct LowerCntCoefs {
+  std::uint64_t realMul;
+  std::uint64_t ordMul;
+  std::uint64_t uniqueMul;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The SmallAlphabetCounts class.
+///
+/// Model lower cumulative counts of all words of a compile-time sized
+/// alphabet in one aligned array. Probability stats are two loads, and a word
+/// is found by a compare and movemask scan (AVX2 or SSE4.2, binary search
+/// without them, see `AEL_ENABLE_AVX2`). Updates go by blocks of `lanesCnt`
+/// counts with loops of fixed length, which compilers turn into vector code.
+///
+template <std::uint64_t maxOrd>
+class SmallAlphabetCounts {
+ public:
+  using Ord = std::uint64_t;
+  using Count = std::uint64_t;
+
+  /// Counts in one 256-bit vector.
+  constexpr static std::size_t lanesCnt = 4;
+  /// Counts array size padded to a whole number of vectors.
+  constexpr static std::size_t paddedSize =
+      (maxOrd + 1 + lanesCnt - 1) / lanesCnt * lanesCnt;
+
+  /// Real counts of words padded with zeros.
+  using WordCnts = std::array<Count, paddedSize>;
+
+ public:
+  SmallAlphabetCounts();
+
+  /**
+   * @brief getLowerCnt - lower cumulative count of a word.
+   * @param ord - order of a word in [0, maxOrd].
+   * @return lower cumulative count. For `maxOrd` it is total count.
+   */
+  [[nodiscard]] Count getLowerCnt(Ord ord) const {
+    return lowerCnts_[ord];
+  }
+
+  /**
+   * @brief increaseAfter - increase lower cumulative counts of all words
+   * after ord and total count.
+   * @param ord - order of a word.
+   * @param delta - count increase.
+   */
+  void increaseAfter(Ord ord, Count delta);
+
+  /**
+   * @brief recalc - calculate lower cumulative counts of all words.
+   * @param wordCnts - real counts of words.
+   * @param coefs - model of lower cumulative counts.
+   */
+  void recalc(const WordCnts& wordCnts, LowerCntCoefs coefs);
+
+  /**
+   * @brief findWord - find a word, which counts interval contains target.
+   * @param target - cumulative count less than total count.
+   * @return word order.
+   */
+  [[nodiscard]] Ord findWord(Count target) const;
+
+ private:
+  // Padding is greater than any count, so scan does not need a tail.
+  constexpr static auto padding_ =
+      static_cast<Count>(std::numeric_limits<std::int64_t>::max());
+
+ private:
+  alignas(32) std::array<Count, paddedSize> lowerCnts_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+template <std::uint64_t maxOrd>
+SmallAlphabetCounts<maxOrd>::SmallAlphabetCounts() {
+  std::fill(lowerCnts_.begin(), lowerCnts_.begin() + maxOrd + 1, Count{0});
+  std::fill(lowerCnts_.begin() + maxOrd + 1, lowerCnts_.end(), padding_);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <std::uint64_t maxOrd>
+void SmallAlphabetCounts<maxOrd>::increaseAfter(Ord ord, Count delta) {
+  // Lanes are masked instead of bounding the loop, padding is left as is.
+  for (auto block = (ord + 1) / lanesCnt * lanesCnt; block < paddedSize;
+       block += lanesCnt) {
+    for (std::size_t lane = 0; lane < lanesCnt; ++lane) {
+      const auto i = block + lane;
+      lowerCnts_[i] += delta * static_cast<Count>(i > ord && i <= maxOrd);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <std::uint64_t maxOrd>
+void SmallAlphabetCounts<maxOrd>::recalc(const WordCnts& wordCnts,
+                                         LowerCntCoefs coefs) {
+  const auto [realMul, ordMul, uniqueMul] = coefs;
+  auto realCarry = Count{0};
+  auto uniqueCarry = Count{0};
+  for (std::size_t block = 0; block < paddedSize; block += lanesCnt) {
+    auto real = std::array<Count, lanesCnt>{};
+    auto unique = std::array<Count, lanesCnt>{};
+    for (std::size_t lane = 0; lane < lanesCnt; ++lane) {
+      real[lane] = wordCnts[block + lane];
+      unique[lane] = static_cast<Count>(real[lane] != 0);
+    }
+    // Inclusive prefix sums of a block in log2(lanesCnt) shifted adds.
+    for (std::size_t shift = 1; shift < lanesCnt; shift *= 2) {
+      const auto prevReal = real;
+      const auto prevUnique = unique;
+      for (std::size_t lane = shift; lane < lanesCnt; ++lane) {
+        real[lane] += prevReal[lane - shift];
+        unique[lane] += prevUnique[lane - shift];
+      }
+    }
+    for (std::size_t lane = 0; lane < lanesCnt; ++lane) {
+      const auto ord = Ord{block + lane};
+      const auto cnt = wordCnts[ord];
+      const auto realLower = realCarry + real[lane] - cnt;
+      const auto uniqueLower =
+          uniqueCarry + unique[lane] - static_cast<Count>(cnt != 0);
+      const auto lower =
+          realMul * realLower + ordMul * ord + uniqueMul * uniqueLower;
+      lowerCnts_[ord] = (ord <= maxOrd) ? lower : padding_;
+    }
+    realCarry += real[lanesCnt - 1];
+    uniqueCarry += unique[lanesCnt - 1];
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <std::uint64_t maxOrd>
+auto SmallAlphabetCounts<maxOrd>::findWord(Count target) const -> Ord {
+  // Lower counts do not decrease, and the first of them is zero, so the word
+  // is one before the first lower count, which is greater than target. Counts
+  // are less than 2^63, so signed comparison is fine.
+  assert(target < lowerCnts_[maxOrd]);
+#if defined(__AVX2__)
+  const auto targetVec = _mm256_set1_epi64x(static_cast<std::int64_t>(target));
+  for (std::size_t i = 0; i < paddedSize; i += 4) {
+    const auto cnts = _mm256_load_si256(
+        reinterpret_cast<const __m256i*>(lowerCnts_.data() + i));
+    const auto greater = _mm256_movemask_pd(
+        _mm256_castsi256_pd(_mm256_cmpgt_epi64(cnts, targetVec)));
+    if (greater != 0) {
+      return i + std::countr_zero(static_cast<unsigned>(greater)) - 1;
+    }
+  }
+  return maxOrd - 1;
+#elif defined(__SSE4_2__)
+  const auto targetVec = _mm_set1_epi64x(static_cast<std::int64_t>(target));
+  for (std::size_t i = 0; i < paddedSize; i += 2) {
+    const auto cnts = _mm_load_si128(
+        reinterpret_cast<const __m128i*>(lowerCnts_.data() + i));
+    const auto greater =
+        _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(cnts, targetVec)));
+    if (greater != 0) {
+      return i + std::countr_zero(static_cast<unsigned>(greater)) - 1;
+    }
+  }
+  return maxOrd - 1;
+#else
+  const auto found = std::upper_bound(
+      lowerCnts_.begin(), lowerCnts_.begin() + maxOrd + 1, target);
+  return static_cast<Ord>(found - lowerCnts_.begin()) - 1;
+#endif
+}
+
+}  // namespace ael::impl::dict
+
+#endif  // AEL_IMPL_DICT_SMALL_ALPHABET_COUNTS_HPP
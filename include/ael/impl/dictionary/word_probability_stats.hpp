@@ -1,8 +1,15 @@
 #ifndef AEL_IMPL_DICT_WORD_PROBABILITY_STATS_HPP
 #define AEL_IMPL_DICT_WORD_PROBABILITY_STATS_HPP
 
+#include <cstdint>
+#include <limits>
+
 namespace ael::impl::dict {
 
+/// Marks total words count, which is not known to be a power of two.
+constexpr std::uint16_t unknownTotalWordsCntLog2 =
+    std::numeric_limits<std::uint16_t>::max();
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief The ProbabilityStats class
 ///
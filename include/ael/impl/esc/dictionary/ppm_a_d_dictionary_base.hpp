@@ -1,10 +1,11 @@
 #ifndef AEL_IMPL_ESC_DICT_PPM_A_D_DICTIONARY_BASE_HPP
 #define AEL_IMPL_ESC_DICT_PPM_A_D_DICTIONARY_BASE_HPP
 
+#include <ael/impl/dictionary/counts_options.hpp>
 #include <ael/impl/dictionary/ctx_base.hpp>
 #include <ael/impl/dictionary/max_ord_base.hpp>
 #include <ael/impl/dictionary/word_probability_stats.hpp>
-#include <boost/container/static_vector.hpp>
+#include <cassert>
 #include <cstdint>
 
 namespace ael::impl::esc::dict {
@@ -24,16 +25,23 @@ class PPMADDictionaryBase
 
  protected:
   constexpr static std::uint16_t maxCtxLength_ = ppmadCtxMaxLength;
-  using SearchCtx_ = boost::container::static_vector<Ord, maxCtxLength_>;
+  using SearchCtx_ = ael::impl::dict::CtxBase<DictT, std::uint64_t,
+                                               ppmadCtxMaxLength>::SearchCtx_;
 
  public:
   PPMADDictionaryBase() = delete;
 
  protected:
-  PPMADDictionaryBase(Ord maxOrd, std::size_t ctxLength)
+  PPMADDictionaryBase(
+      Ord maxOrd, std::size_t ctxLength,
+      Count rescaleThreshold = ael::impl::dict::noRescale,
+      std::size_t maxCtxsCnt = ael::impl::dict::noCtxsLimit,
+      ael::impl::dict::CtxsLimitPolicy ctxsLimitPolicy =
+          ael::impl::dict::CtxsLimitPolicy::restart)
       : MaxOrdBase(maxOrd),
         ael::impl::dict::CtxBase<DictT, std::uint64_t, ppmadCtxMaxLength>(
-            ctxLength) {
+            ctxLength, maxCtxsCnt, ctxsLimitPolicy),
+        rescaleThreshold_{rescaleThreshold} {
   }
 
  public:
@@ -55,6 +63,10 @@ class PPMADDictionaryBase
 
   void updateEscDecoded_(Ord ord);
 
+  [[nodiscard]] Count getRescaleThreshold_() const {
+    return rescaleThreshold_;
+  }
+
   void skipCtxsByEsc_(SearchCtx_& currCtx) const {
     assert(getEscDecoded_() < currCtx.size() && "Checked other cases.");
     currCtx.resize(currCtx.size() - getEscDecoded_());
@@ -62,6 +74,7 @@ class PPMADDictionaryBase
 
  private:
   std::size_t escDecoded_{0};
+  const Count rescaleThreshold_;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2,35 +2,107 @@
 #define AEL_IMPL_MULTIPLY_AND_DIVIDE_HPP
 
 #include <boost/multiprecision/cpp_int.hpp>
+#include <cassert>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 namespace ael::impl {
 
 namespace bm = boost::multiprecision;
 
+#if defined(__SIZEOF_INT128__)
+#define AEL_HAS_NATIVE_UINT128 1
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Unsigned type with at least twice as many bits as CountT, used for
+/// intermediate products.
+template <class CountT>
+struct DoubleWidth;
+
+template <>
+struct DoubleWidth<std::uint32_t> {
+  using Type = std::uint64_t;
+};
+
+template <>
+struct DoubleWidth<std::uint64_t> {
+#ifdef AEL_HAS_NATIVE_UINT128
+  __extension__ using Type = unsigned __int128;
+#else
+  using Type = bm::uint128_t;
+#endif
+};
+
+template <class CountT>
+using DoubleWidthT = typename DoubleWidth<CountT>::Type;
+
 /**
  * @brief multiply_and_divide calculate (left * right) / divider assuming that
- * result is under 64 bits.
+ * result fits into CountT.
  * @param left
  * @param right
  * @param divider
  * @return (left * right) / divider
  */
-std::uint64_t multiply_and_divide(std::uint64_t left, std::uint64_t right,
-                                  std::uint64_t divider);
+template <std::unsigned_integral CountT>
+inline CountT multiply_and_divide(CountT left, CountT right, CountT divider) {
+  assert(divider != 0 && "Division by zero.");
+#if defined(__x86_64__) && defined(__GNUC__)
+  if constexpr (std::is_same_v<CountT, std::uint64_t>) {
+    // One mul and one div: the quotient is known to fit into 64 bits.
+    std::uint64_t productLow;   // NOLINT(cppcoreguidelines-init-variables)
+    std::uint64_t productHigh;  // NOLINT(cppcoreguidelines-init-variables)
+    std::uint64_t quotient;     // NOLINT(cppcoreguidelines-init-variables)
+    std::uint64_t remainder;    // NOLINT(cppcoreguidelines-init-variables)
+    asm("mulq %3"
+        : "=a"(productLow), "=d"(productHigh)
+        : "a"(left), "rm"(right));
+    assert(productHigh < divider && "Quotient does not fit into 64 bits.");
+    asm("divq %4"
+        : "=a"(quotient), "=d"(remainder)
+        : "a"(productLow), "d"(productHigh), "rm"(divider));
+    return quotient;
+  }
+#endif
+  using Wide = DoubleWidthT<CountT>;
+  return static_cast<CountT>(Wide{left} * Wide{right} / Wide{divider});
+}
 
 /**
  * @brief multiply_decrease_and_divide calculate (left * right - 1) / divider
- * assuming that result is under 64 bits.
+ * assuming that left * right is not zero and result fits into CountT.
  * @param left
  * @param right
- * @param ddivider
+ * @param divider
  * @return (left * right - 1) / divider
  */
-std::uint64_t multiply_decrease_and_divide(std::uint64_t left,
-                                           std::uint64_t right,
-                                           std::uint64_t divider);
+template <std::unsigned_integral CountT>
+inline CountT multiply_decrease_and_divide(CountT left, CountT right,
+                                           CountT divider) {
+  assert(divider != 0 && "Division by zero.");
+  using Wide = DoubleWidthT<CountT>;
+  const auto product = Wide{left} * Wide{right};
+  assert(product != 0 && "Product must be positive.");
+  return static_cast<CountT>((product - 1) / Wide{divider});
+}
+
+/**
+ * @brief multiply_and_shift calculate (left * right) >> shift without
+ * overflow of the product, assuming that result fits into CountT.
+ * @param left
+ * @param right
+ * @param shift
+ * @return (left * right) >> shift
+ */
+template <std::unsigned_integral CountT>
+inline CountT multiply_and_shift(CountT left, CountT right,
+                                 std::uint16_t shift) {
+  using Wide = DoubleWidthT<CountT>;
+  return static_cast<CountT>((Wide{left} * Wide{right}) >> shift);
+}
 
 template <std::size_t numBits>
 using WideNum =
@@ -73,6 +145,22 @@ WideNum<numBits> multiply_decrease_and_divide(const WideNum<numBits>& left,
       .template convert_to<WideNum<numBits>>();
 }
 
+/**
+ * @brief multiply_and_shift calculate (left * right) >> shift assuming that
+ * result is ok for a type of inputs.
+ * @param left
+ * @param right
+ * @param shift
+ * @return (left * right) >> shift
+ */
+template <std::size_t numBits>
+WideNum<numBits> multiply_and_shift(const WideNum<numBits>& left,
+                                    const WideNum<numBits>& right,
+                                    std::uint16_t shift) {
+  return ((WideNum<numBits * 2>{left} * WideNum<numBits * 2>{right}) >> shift)
+      .template convert_to<WideNum<numBits>>();
+}
+
 }  // namespace ael::impl
 
 #endif  // AEL_IMPL_MULTIPLY_AND_DIVIDE_HPP
@@ -1,8 +1,6 @@
 #ifndef AEL_IMPL_RANGE_AND_VALUE_SAVE_BASE_HPP
 #define AEL_IMPL_RANGE_AND_VALUE_SAVE_BASE_HPP
 
-#include <ranges>
-
 #include "range_save_base.hpp"
 
 namespace ael::impl {
@@ -33,10 +31,8 @@ template <class Derived>
 template <class RC>
 RC::Count RangeAndValueSaveBase<Derived>::calcValue_() {
   if (firstDecode_) {
-    auto ret = typename RC::Count{0};
-    for (auto _ : std::ranges::iota_view(std::size_t{0}, RC::numBits)) {
-      ret = (ret << 1) + this_().template takeBit_<typename RC::Count>();
-    }
+    const auto ret =
+        this_().template takeBits_<typename RC::Count>(RC::numBits);
     firstDecode_ = false;
     return ret;
   }
@@ -0,0 +1,45 @@
+#ifndef AEL_IMPL_RANGE_CODER_STATE_HPP
+#define AEL_IMPL_RANGE_CODER_STATE_HPP
+
+#include <cstdint>
+
+#include "multiply_and_divide.hpp"
+
+namespace ael::impl {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Byte-oriented range coder interval, saved between calls with
+/// dictionaries of different count widths.
+///
+/// Interval is `[low, low + range)` inside a window of `numBits` bits. Low
+/// may have one more bit for a carry.
+///
+struct RangeCoderState {
+  using WideNum = boost::multiprecision::uint256_t;
+
+  WideNum low{0};
+  WideNum range{1};
+  std::uint16_t numBits{0};
+
+  /**
+   * @brief rescale - change window width. On narrowing interval borders are
+   * rounded inwards.
+   * @param newNumBits - new window width.
+   */
+  void rescale(std::uint16_t newNumBits) {
+    if (newNumBits >= numBits) {
+      low <<= newNumBits - numBits;
+      range <<= newNumBits - numBits;
+    } else {
+      const auto shift = numBits - newNumBits;
+      const auto newLow = (low + (WideNum{1} << shift) - 1) >> shift;
+      range = ((low + range) >> shift) - newLow;
+      low = newLow;
+    }
+    numBits = newNumBits;
+  }
+};
+
+}  // namespace ael::impl
+
+#endif  // AEL_IMPL_RANGE_CODER_STATE_HPP
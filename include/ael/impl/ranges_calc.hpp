@@ -2,45 +2,179 @@
 #define AEL_IMPL_RANGES_CALC_HPP
 
 #include <ael/impl/dictionary/word_probability_stats.hpp>
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
 #include <cstdint>
+#include <limits>
 
 #include "multiply_and_divide.hpp"
 
 namespace ael::impl {
 
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Arithmetic used to narrow a range by word probability.
+///
+enum class RangesCalcMode {
+  /// Two exact multiply-divides per word.
+  exact,
+  /// `range / total` is calculated once per word and reused for low, high
+  /// and decode target. Loses a little compression on rounding.
+  singleDivision
+};
+
+/**
+ * @brief Ranges calculation mode of a dictionary. Dictionary may opt in by
+ * defining `constexpr static RangesCalcMode rangesCalcMode`.
+ */
+template <class DictT>
+constexpr RangesCalcMode rangesCalcModeOf = RangesCalcMode::exact;
+
+template <class DictT>
+  requires requires { DictT::rangesCalcMode; }
+constexpr RangesCalcMode rangesCalcModeOf<DictT> = DictT::rangesCalcMode;
+
+using dict::unknownTotalWordsCntLog2;
+
+/**
+ * @brief Binary logarithm of dictionary total words count if it is a known
+ * power of two. Dictionary may declare it at compile time with
+ * `constexpr static std::uint16_t totalWordsCntLog2` or at runtime with
+ * `getTotalWordsCntLog2()` method.
+ * @param dict - dictionary.
+ * @return logarithm or `unknownTotalWordsCntLog2`.
+ */
+template <class DictT>
+std::uint16_t getTotalWordsCntLog2(const DictT& dict) {
+  if constexpr (requires { DictT::totalWordsCntLog2; }) {
+    return DictT::totalWordsCntLog2;
+  } else if constexpr (requires { dict.getTotalWordsCntLog2(); }) {
+    return dict.getTotalWordsCntLog2();
+  } else {
+    return unknownTotalWordsCntLog2;
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief The RangesCalc class
 ///
-template <class CountT, std::uint16_t numBits_>
+template <class CountT, std::uint16_t numBits_,
+          RangesCalcMode mode_ = RangesCalcMode::exact>
 class RangesCalc {
  public:
   using Count = CountT;
   struct Range;
+  struct ScaledRange;
   using ProbabilityStats = ael::impl::dict::WordProbabilityStats<Count>;
 
+  constexpr static const RangesCalcMode mode = mode_;
+
   constexpr static const std::uint16_t numBits = numBits_;
   constexpr static const Count total = Count{1} << numBits;
   constexpr static const Count half = Count{1} << (numBits - 1);
   constexpr static const Count quarter = Count{1} << (numBits - 2);
   constexpr static const Count threeQuarters = 3 * quarter;
 
+  /// Renormalization may be done in bulk by counting leading bits.
+  constexpr static const bool bulkRenorm =
+      std::unsigned_integral<Count> &&
+      numBits < std::numeric_limits<Count>::digits;
+
   static Range recalcRange(Range rng);
 
+  /**
+   * @brief countSettledBits - number of leading bits, which are same for all
+   * values in range.
+   * @param rng - range.
+   * @return number of settled bits.
+   */
+  static std::uint16_t countSettledBits(Range rng)
+    requires bulkRenorm;
+
+  /**
+   * @brief shiftSettled - shift out `num` settled leading bits.
+   * @param rng - range.
+   * @param num - number of settled bits to shift out.
+   * @return range after shift.
+   */
+  static Range shiftSettled(Range rng, std::uint16_t num)
+    requires bulkRenorm;
+
+  /**
+   * @brief countFollowBits - number of bits to follow (middle half
+   * expansions) for a range, which has no settled bits.
+   * @param rng - range.
+   * @return number of bits to follow.
+   */
+  static std::uint16_t countFollowBits(Range rng)
+    requires bulkRenorm;
+
+  /**
+   * @brief shiftFollow - apply `num` middle half expansions.
+   * @param rng - range.
+   * @param num - number of expansions.
+   * @return range after expansions.
+   */
+  static Range shiftFollow(Range rng, std::uint16_t num)
+    requires bulkRenorm;
+
   static Range rangeFromStatsAndPrev(Range rng, ProbabilityStats probStats);
+
+  /**
+   * @brief scaleRange - prepare range for narrowing by words with given
+   * total count.
+   * @param rng - range.
+   * @param totalWords - total words count.
+   * @param totalWordsLog2 - log2 of `totalWords` if it is a power of two.
+   * Then words ranges are calculated with shifts instead of divisions.
+   * @return scaled range.
+   */
+  static ScaledRange scaleRange(
+      Range rng, Count totalWords,
+      std::uint16_t totalWordsLog2 = unknownTotalWordsCntLog2);
+
+  /**
+   * @brief calcDecodeTarget - cumulative count, which corresponds to a value.
+   * @param scaled - scaled range.
+   * @param value - decoded value.
+   * @return target cumulative count to look up a word by.
+   */
+  static Count calcDecodeTarget(const ScaledRange& scaled, Count value);
+
+  /**
+   * @brief rangeFromScaledAndStats - narrow scaled range by word probability.
+   * @param scaled - scaled range.
+   * @param probStats - word probability stats.
+   * @return narrowed range.
+   */
+  static Range rangeFromScaledAndStats(const ScaledRange& scaled,
+                                       ProbabilityStats probStats);
 };
 
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief The Range class
 ///
-template <class CountT, std::uint16_t numBits>
-struct RangesCalc<CountT, numBits>::Range {
+template <class CountT, std::uint16_t numBits, RangesCalcMode mode>
+struct RangesCalc<CountT, numBits, mode>::Range {
   Count low = Count{0};
   Count high = total;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
-template <class CountT, std::uint16_t numBits>
-auto RangesCalc<CountT, numBits>::recalcRange(Range rng) -> Range {
+/// \brief The ScaledRange class
+///
+template <class CountT, std::uint16_t numBits, RangesCalcMode mode>
+struct RangesCalc<CountT, numBits, mode>::ScaledRange {
+  Range rng;
+  Count totalWords;
+  std::uint16_t totalWordsLog2;
+  Count step;  // Only used in `RangesCalcMode::singleDivision`.
+};
+
+////////////////////////////////////////////////////////////////////////////////
+template <class CountT, std::uint16_t numBits, RangesCalcMode mode>
+auto RangesCalc<CountT, numBits, mode>::recalcRange(Range rng) -> Range {
   if (rng.high <= half) {
     return {rng.low * 2, rng.high * 2};
   }
@@ -54,17 +188,122 @@ auto RangesCalc<CountT, numBits>::recalcRange(Range rng) -> Range {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-template <class CountT, std::uint16_t numBits>
-auto RangesCalc<CountT, numBits>::rangeFromStatsAndPrev(
+template <class CountT, std::uint16_t numBits, RangesCalcMode mode>
+std::uint16_t RangesCalc<CountT, numBits, mode>::countSettledBits(Range rng)
+  requires bulkRenorm
+{
+  constexpr auto unusedBits = std::numeric_limits<Count>::digits - numBits;
+  const auto diff = static_cast<Count>(rng.low ^ (rng.high - 1));
+  return static_cast<std::uint16_t>(std::countl_zero(diff) - unusedBits);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class CountT, std::uint16_t numBits, RangesCalcMode mode>
+auto RangesCalc<CountT, numBits, mode>::shiftSettled(Range rng, std::uint16_t num)
+    -> Range
+  requires bulkRenorm
+{
+  const auto ones = static_cast<Count>((Count{1} << num) - 1);
+  const auto low = static_cast<Count>(rng.low << num) & (total - 1);
+  const auto last =
+      (static_cast<Count>((rng.high - 1) << num) | ones) & (total - 1);
+  return {low, last + 1};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class CountT, std::uint16_t numBits, RangesCalcMode mode>
+std::uint16_t RangesCalc<CountT, numBits, mode>::countFollowBits(Range rng)
+  requires bulkRenorm
+{
+  constexpr auto shift = std::numeric_limits<Count>::digits - numBits + 1;
+  const auto lowTail = static_cast<Count>(rng.low << shift);
+  const auto lastTail = static_cast<Count>((rng.high - 1) << shift);
+  return static_cast<std::uint16_t>(
+      std::min(std::countl_one(lowTail), std::countl_zero(lastTail)));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class CountT, std::uint16_t numBits, RangesCalcMode mode>
+auto RangesCalc<CountT, numBits, mode>::shiftFollow(Range rng, std::uint16_t num)
+    -> Range
+  requires bulkRenorm
+{
+  const auto ones = static_cast<Count>((Count{1} << num) - 1);
+  const auto low = static_cast<Count>(rng.low << num) & (half - 1);
+  const auto last =
+      half | ((static_cast<Count>((rng.high - 1) << num) | ones) & (half - 1));
+  return {low, last + 1};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class CountT, std::uint16_t numBits, RangesCalcMode mode>
+auto RangesCalc<CountT, numBits, mode>::rangeFromStatsAndPrev(
     Range rng, ProbabilityStats probStats) -> Range {
-  const auto range = rng.high - rng.low;
+  return rangeFromScaledAndStats(scaleRange(rng, probStats.total), probStats);
+}
 
-  const auto lowScaled =
-      multiply_and_divide(range, probStats.low, probStats.total);
-  const auto highScaled =
-      multiply_and_divide(range, probStats.high, probStats.total);
+////////////////////////////////////////////////////////////////////////////////
+template <class CountT, std::uint16_t numBits, RangesCalcMode mode>
+auto RangesCalc<CountT, numBits, mode>::scaleRange(
+    Range rng, Count totalWords, std::uint16_t totalWordsLog2) -> ScaledRange {
+  assert(totalWordsLog2 == unknownTotalWordsCntLog2 ||
+         totalWords == Count{1} << totalWordsLog2);
+  if constexpr (mode == RangesCalcMode::singleDivision) {
+    const auto range = Count{rng.high - rng.low};
+    const auto step = (totalWordsLog2 != unknownTotalWordsCntLog2)
+                          ? Count{range >> totalWordsLog2}
+                          : Count{range / totalWords};
+    assert(step != 0 && "Total words count is too big for a range.");
+    return {rng, totalWords, totalWordsLog2, step};
+  } else {
+    return {rng, totalWords, totalWordsLog2, Count{0}};
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class CountT, std::uint16_t numBits, RangesCalcMode mode>
+auto RangesCalc<CountT, numBits, mode>::calcDecodeTarget(
+    const ScaledRange& scaled, Count value) -> Count {
+  const auto offset = Count{value - scaled.rng.low};
+  if constexpr (mode == RangesCalcMode::singleDivision) {
+    // Tail of the range after `step * totalWords` belongs to the last word.
+    return std::min(Count{offset / scaled.step},
+                    Count{scaled.totalWords - 1});
+  } else {
+    const auto range = Count{scaled.rng.high - scaled.rng.low};
+    return multiply_decrease_and_divide(Count{offset + 1}, scaled.totalWords,
+                                        range);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class CountT, std::uint16_t numBits, RangesCalcMode mode>
+auto RangesCalc<CountT, numBits, mode>::rangeFromScaledAndStats(
+    const ScaledRange& scaled, ProbabilityStats probStats) -> Range {
+  assert(probStats.total == scaled.totalWords);
+  const auto rng = scaled.rng;
+  if constexpr (mode == RangesCalcMode::singleDivision) {
+    const auto low = Count{rng.low + scaled.step * probStats.low};
+    const auto high = (probStats.high == probStats.total)
+                          ? rng.high
+                          : Count{rng.low + scaled.step * probStats.high};
+    return {low, high};
+  } else {
+    const auto range = Count{rng.high - rng.low};
 
-  return {rng.low + lowScaled, rng.low + highScaled};
+    if (scaled.totalWordsLog2 != unknownTotalWordsCntLog2) {
+      const auto log2 = scaled.totalWordsLog2;
+      return {rng.low + multiply_and_shift(range, probStats.low, log2),
+              rng.low + multiply_and_shift(range, probStats.high, log2)};
+    }
+
+    const auto lowScaled =
+        multiply_and_divide(range, probStats.low, probStats.total);
+    const auto highScaled =
+        multiply_and_divide(range, probStats.high, probStats.total);
+
+    return {rng.low + lowScaled, rng.low + highScaled};
+  }
 }
 
 }  // namespace ael::impl
@@ -0,0 +1,173 @@
+#ifndef AEL_RANGE_CODER_HPP
+#define AEL_RANGE_CODER_HPP
+
+#include <ael/byte_data_constructor.hpp>
+#include <ael/impl/range_coder_state.hpp>
+#include <ael/impl/ranges_calc.hpp>
+#include <climits>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+
+namespace ael {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The RangeCoder class.
+///
+/// Byte-oriented range coder with carry propagation through a cached byte
+/// (LZMA-style). Uses the same dictionaries as ArithmeticCoder. Interval is
+/// kept in a window of `DictT::countNumBits` bits and is renormalized a byte
+/// at a time, so dictionary total words count must not be bigger than
+/// `2^(countNumBits - 8)`. Totals, which ArithmeticCoder takes up to
+/// `2^countNumBits`, are rejected above this bound.
+///
+class RangeCoder {
+ public:
+  struct Stats {
+    std::size_t wordsCount;
+    std::size_t bitsEncoded;
+  };
+
+  struct FinalRet {
+    std::unique_ptr<ByteDataConstructor> dataConstructor;
+    std::size_t wordsCount;
+    std::size_t bitsEncoded;
+  };
+
+ public:
+  explicit RangeCoder(std::unique_ptr<ByteDataConstructor>&& dataConstructor =
+                          std::make_unique<ByteDataConstructor>());
+
+  /**
+   * @brief encode - encode byte flow.
+   * @param ordFlow orders range.
+   * @param dict dictionary with words statistics.
+   * @return rvalue reference to this coder.
+   * @throws std::invalid_argument if total words count of the dictionary is
+   * bigger than `2^(countNumBits - 8)`. Words before it stay encoded.
+   */
+  template <std::ranges::input_range OrdFlow, class DictT>
+  RangeCoder&& encode(const OrdFlow& ordFlow, DictT& dict);
+
+  /**
+   * @brief encode - encode byte flow.
+   * @param ordFlow orders range.
+   * @param dict dictionary with words statistics.
+   * @param tick function, which will be called every time when one element is
+   * encoded.
+   * @return rvalue reference to this coder.
+   * @throws std::invalid_argument if total words count of the dictionary is
+   * bigger than `2^(countNumBits - 8)`. Words before it stay encoded.
+   */
+  template <std::ranges::input_range OrdFlow, class DictT>
+  RangeCoder&& encode(
+      const OrdFlow& ordFlow, DictT& dict, auto tick = [] {});
+
+  /**
+   * @brief Get encoded orders and encoded bits counts change since last
+   * `getStatsChange()` call. On a first call returns just encoded orders and
+   * encoded bits counts.
+   *
+   * @return [encodedOrdersChange, encodedBitsChange]
+   */
+  Stats getStatsChange();
+
+  FinalRet finalize() &&;
+
+ private:
+  template <class CountT>
+  void shiftLow_(CountT& low, std::uint16_t numBits);
+
+  void putPendingBytes_(bool carry);
+
+ private:
+  std::unique_ptr<ByteDataConstructor> dataConstructor_;
+  impl::RangeCoderState state_{};
+  std::uint8_t cache_{0};
+  std::size_t pendingBytes_{0};
+  std::size_t bytesEncoded_{0};
+  std::size_t wordsCnt_{0};
+  std::size_t prevBytesEncoded_{0};
+  std::size_t prevWordsCnt_{0};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+inline RangeCoder::RangeCoder(
+    std::unique_ptr<ByteDataConstructor>&& dataConstructor)
+    : dataConstructor_{std::move(dataConstructor)} {
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <std::ranges::input_range OrdFlow, class DictT>
+RangeCoder&& RangeCoder::encode(const OrdFlow& ordFlow, DictT& dict) {
+  return encode(ordFlow, dict, [] {});
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <std::ranges::input_range OrdFlow, class DictT>
+RangeCoder&& RangeCoder::encode(const OrdFlow& ordFlow, DictT& dict,
+                                auto tick) {
+  using RC = impl::RangesCalc<typename DictT::Count, DictT::countNumBits,
+                              impl::rangesCalcModeOf<DictT>>;
+  using Count = typename RC::Count;
+  static_assert(RC::numBits < std::numeric_limits<Count>::digits,
+                "No place for a carry bit.");
+  constexpr auto bottom = Count{1} << (RC::numBits - CHAR_BIT);
+
+  state_.rescale(RC::numBits);
+  auto low = static_cast<Count>(state_.low);
+  auto range = static_cast<Count>(state_.range);
+  const auto renormalize = [&] {
+    while (range < bottom) {
+      shiftLow_(low, RC::numBits);
+      range <<= CHAR_BIT;
+    }
+  };
+  renormalize();
+
+  for (auto ord : ordFlow) {
+    const auto totalLog2 = impl::getTotalWordsCntLog2(dict);
+    const auto [wordLow, wordHigh, total] = dict.getProbabilityStats(ord);
+    if (total > bottom) {
+      state_.low = impl::RangeCoderState::WideNum{low};
+      state_.range = impl::RangeCoderState::WideNum{range};
+      throw std::invalid_argument("Total words count is too big for coder.");
+    }
+    const auto scaled = RC::scaleRange({Count{0}, range}, total, totalLog2);
+    const auto [offsetLow, offsetHigh] =
+        RC::rangeFromScaledAndStats(scaled, {wordLow, wordHigh, total});
+    low += offsetLow;
+    range = offsetHigh - offsetLow;
+
+    renormalize();
+    ++wordsCnt_;
+    tick();
+  }
+
+  state_.low = impl::RangeCoderState::WideNum{low};
+  state_.range = impl::RangeCoderState::WideNum{range};
+
+  return std::move(*this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class CountT>
+void RangeCoder::shiftLow_(CountT& low, std::uint16_t numBits) {
+  const auto topByte = static_cast<std::uint8_t>(
+      (low >> (numBits - CHAR_BIT)) & CountT{0xFF});
+  if (const bool carry = (low >> numBits) != 0; carry || topByte != 0xFF) {
+    // Byte before the top one can not change any more.
+    putPendingBytes_(carry);
+  }
+  if (pendingBytes_ == 0) {
+    cache_ = topByte;
+  }
+  ++pendingBytes_;
+  low = (low << CHAR_BIT) & ((CountT{1} << numBits) - 1);
+}
+
+}  // namespace ael
+
+#endif  // AEL_RANGE_CODER_HPP
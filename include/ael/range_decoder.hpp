@@ -0,0 +1,178 @@
+#ifndef AEL_RANGE_DECODER_HPP
+#define AEL_RANGE_DECODER_HPP
+
+#include <ael/impl/dictionary/decoded_word.hpp>
+#include <ael/impl/range_coder_state.hpp>
+#include <ael/impl/ranges_calc.hpp>
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+
+namespace ael {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief The RangeDecoder class.
+///
+/// Decoder for RangeCoder output.
+///
+template <class SourceT>
+class RangeDecoder {
+ public:
+  explicit RangeDecoder(
+      SourceT& source,
+      std::size_t bitsLimit = std::numeric_limits<std::size_t>::max());
+
+  /**
+   * @param dict - dictionary (probability model).
+   * @param outIter - output iterator for decoded sequence.
+   * @param wordsLimit - number of words to decode.
+   */
+  template <std::output_iterator<std::uint64_t> OutIter, class Dict>
+  void decode(Dict& dict, OutIter outIter, std::size_t wordsLimit);
+
+  /**
+   * @param dict - dictionary (probability model).
+   * @param outIter - output iterator for decoded sequence.
+   * @param wordsLimit - number of words to decode.
+   * @param tick - lambda to do a tick (for example, for logging).
+   */
+  template <std::output_iterator<std::uint64_t> OutIter, class Dict>
+  void decode(Dict& dict, OutIter outIter, std::size_t wordsLimit, auto tick);
+
+ private:
+  using WideNum_ = impl::RangeCoderState::WideNum;
+
+ private:
+  void rescale_(std::uint16_t numBits);
+
+  template <typename CountT>
+  CountT takeBits_(std::size_t num);
+
+ private:
+  constexpr static std::size_t maxBitsAtOnce_ = SourceT::maxBitsAtOnce;
+
+ private:
+  SourceT* source_;
+  const std::size_t bitsLimit_;
+  std::size_t bitsDecoded_{};
+  impl::RangeCoderState state_{};
+  WideNum_ value_{0};
+  // Bits, which were taken from source, but are not in a window after
+  // narrowing it. They are taken before next source bits.
+  WideNum_ surplus_{0};
+  std::size_t surplusCnt_{0};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+template <class SourceT>
+inline RangeDecoder<SourceT>::RangeDecoder(SourceT& source,
+                                           std::size_t bitsLimit)
+    : source_{&source}, bitsLimit_{bitsLimit} {
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class SourceT>
+template <std::output_iterator<std::uint64_t> OutIter, class Dict>
+void RangeDecoder<SourceT>::decode(Dict& dict, OutIter outIter,
+                                   std::size_t wordsLimit) {
+  return decode(dict, outIter, wordsLimit, [] {});
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class SourceT>
+template <std::output_iterator<std::uint64_t> OutIter, class Dict>
+void RangeDecoder<SourceT>::decode(Dict& dict, OutIter outIter,
+                                   std::size_t wordsLimit, auto tick) {
+  using RC = impl::RangesCalc<typename Dict::Count, Dict::countNumBits,
+                              impl::rangesCalcModeOf<Dict>>;
+  using Count = typename RC::Count;
+  static_assert(RC::numBits < std::numeric_limits<Count>::digits,
+                "No place for a carry bit.");
+  constexpr auto bottom = Count{1} << (RC::numBits - CHAR_BIT);
+  constexpr auto mask = RC::total - 1;
+
+  rescale_(RC::numBits);
+  // Only `value - low` is needed for decoding, low is kept for rescaling.
+  auto low = static_cast<Count>(state_.low);
+  auto range = static_cast<Count>(state_.range);
+  auto code = static_cast<Count>((value_ - state_.low) & WideNum_{mask});
+  const auto renormalize = [&] {
+    while (range < bottom) {
+      low = (low << CHAR_BIT) & mask;
+      code = (code << CHAR_BIT) | takeBits_<Count>(CHAR_BIT);
+      range <<= CHAR_BIT;
+    }
+  };
+  renormalize();
+
+  for (auto i : std::ranges::iota_view(std::size_t{0}, wordsLimit)) {
+    assert(code < range);
+    const auto scaled =
+        RC::scaleRange({Count{0}, range}, dict.getTotalWordsCnt(),
+                       impl::getTotalWordsCntLog2(dict));
+    const auto [ord, wordLow, wordHigh, total] =
+        impl::dict::decodeWord(dict, RC::calcDecodeTarget(scaled, code));
+    *outIter = ord;
+    ++outIter;
+
+    const auto [offsetLow, offsetHigh] =
+        RC::rangeFromScaledAndStats(scaled, {wordLow, wordHigh, total});
+    low = (low + offsetLow) & mask;
+    code -= offsetLow;
+    range = offsetHigh - offsetLow;
+
+    renormalize();
+    tick();
+  }
+
+  state_.low = WideNum_{low};
+  state_.range = WideNum_{range};
+  value_ = WideNum_{static_cast<Count>((low + code) & mask)};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class SourceT>
+void RangeDecoder<SourceT>::rescale_(std::uint16_t numBits) {
+  if (numBits >= state_.numBits) {
+    const auto shift = numBits - state_.numBits;
+    value_ = (value_ << shift) | takeBits_<WideNum_>(shift);
+  } else {
+    const auto shift = state_.numBits - numBits;
+    surplus_ |= (value_ & ((WideNum_{1} << shift) - 1)) << surplusCnt_;
+    surplusCnt_ += shift;
+    value_ >>= shift;
+  }
+  state_.rescale(numBits);
+  state_.low &= (WideNum_{1} << numBits) - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <class SourceT>
+template <class CountT>
+CountT RangeDecoder<SourceT>::takeBits_(std::size_t num) {
+  auto ret = CountT{0};
+  if (surplusCnt_ != 0) {
+    const auto taken = std::min(num, surplusCnt_);
+    surplusCnt_ -= taken;
+    ret = static_cast<CountT>(surplus_ >> surplusCnt_);
+    surplus_ &= (WideNum_{1} << surplusCnt_) - 1;
+    num -= taken;
+  }
+  while (num != 0) {
+    const auto chunk = std::min(num, maxBitsAtOnce_);
+    const auto available = std::min(chunk, bitsLimit_ - bitsDecoded_);
+    bitsDecoded_ += available;
+    const auto bits = static_cast<CountT>(source_->takeBits(available));
+    ret = (ret << chunk) | (bits << (chunk - available));
+    num -= chunk;
+  }
+  return ret;
+}
+
+}  // namespace ael
+
+#endif  // AEL_RANGE_DECODER_HPP
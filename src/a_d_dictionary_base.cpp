@@ -3,16 +3,16 @@
 namespace ael::impl::dict {
 
 ////////////////////////////////////////////////////////////////////////////////
-ADDictionaryBase::ADDictionaryBase(Ord maxOrd)
+ADDictionaryBase::ADDictionaryBase(Ord maxOrd, CountsLayout layout,
+                                   Count rescaleThreshold,
+                                   std::pmr::memory_resource* resource)
     : MaxOrdBase(maxOrd),
-      cumulativeCnt_(maxOrd),
-      cumulativeUniqueCnt_(maxOrd) {
+      cumulativeCnts_(maxOrd, layout, rescaleThreshold, resource) {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 void ADDictionaryBase::updateWordCnt_(Ord ord, Count cnt) {
-  cumulativeCnt_.increaseOrdCount(ord, static_cast<std::int64_t>(cnt));
-  cumulativeUniqueCnt_.update(ord);
+  cumulativeCnts_.increaseOrdCount(ord, cnt);
 }
 
 }  // namespace ael::impl::dict
@@ -1,22 +1,18 @@
 #include <ael/dictionary/adaptive_a_dictionary.hpp>
-#include <ranges>
 
 namespace ael::dict {
 
-namespace rng = std::ranges;
-
 ////////////////////////////////////////////////////////////////////////////////
-AdaptiveADictionary::AdaptiveADictionary(Ord maxOrd)
-    : ael::impl::dict::ADDictionaryBase(maxOrd) {
+AdaptiveADictionary::AdaptiveADictionary(
+    Ord maxOrd, ael::impl::dict::CountsLayout layout, Count rescaleThreshold,
+    std::pmr::memory_resource* resource)
+    : ael::impl::dict::ADDictionaryBase(maxOrd, layout, rescaleThreshold,
+                                        resource) {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 auto AdaptiveADictionary::getWordOrd(Count cumulativeCnt) const -> Ord {
-  const auto getLowerCumulCnt = [this](Ord ord) {
-    return getLowerCumulativeCnt_(ord + 1);
-  };
-  return *rng::upper_bound(this->getOrdRng_(), cumulativeCnt, {},
-                           getLowerCumulCnt);
+  return findWord_(cumulativeCnt).ord;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +22,13 @@ auto AdaptiveADictionary::getProbabilityStats(Ord ord) -> ProbabilityStats {
   return ret;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+auto AdaptiveADictionary::decodeSymbol(Count cumulativeCnt) -> DecodedWord {
+  const auto ret = findWord_(cumulativeCnt);
+  updateWordCnt_(ret.ord, 1);
+  return ret;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 auto AdaptiveADictionary::getTotalWordsCnt() const -> Count {
   const auto uniqueWordsCnt = getTotalWordsUniqueCnt_();
@@ -38,15 +41,20 @@ auto AdaptiveADictionary::getTotalWordsCnt() const -> Count {
 
 ////////////////////////////////////////////////////////////////////////////////
 auto AdaptiveADictionary::getLowerCumulativeCnt_(Ord ord) const -> Count {
-  const auto cumulativeNumFound = getRealLowerCumulativeWordCnt_(ord);
+  const auto [realLowerCnt, uniqueLowerCnt] = getLowerCumulativeCnts_(ord);
+  return calcLowerCumulativeCnt_(ord, realLowerCnt, uniqueLowerCnt);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto AdaptiveADictionary::calcLowerCumulativeCnt_(Ord ord, Count realLowerCnt,
+                                                  Count uniqueLowerCnt) const
+    -> Count {
   if (getMaxOrd_() == getTotalWordsUniqueCnt_()) {
-    return cumulativeNumFound;
+    return realLowerCnt;
   }
   const auto numUniqueWordsTotal = getTotalWordsUniqueCnt_();
-  const auto cumulativeUniqueWordsNumFound =
-      getLowerCumulativeUniqueNumFound_(ord);
-  return (getMaxOrd_() - numUniqueWordsTotal) * cumulativeNumFound +
-         (ord - cumulativeUniqueWordsNumFound);
+  return (getMaxOrd_() - numUniqueWordsTotal) * realLowerCnt +
+         (ord - uniqueLowerCnt);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -69,4 +77,15 @@ auto AdaptiveADictionary::getProbabilityStats_(Ord ord) const
   return {low, high, total};
 }
 
+////////////////////////////////////////////////////////////////////////////////
+auto AdaptiveADictionary::findWord_(Count cumulativeCnt) const
+    -> DecodedWord {
+  const auto calcLowerCumulCnt = [this](Ord ord, Count realLowerCnt,
+                                        Count uniqueLowerCnt) {
+    return calcLowerCumulativeCnt_(ord, realLowerCnt, uniqueLowerCnt);
+  };
+  const auto [ord, low] = findLastNotGreater_(cumulativeCnt, calcLowerCumulCnt);
+  return {ord, low, low + getWordCnt_(ord), getTotalWordsCnt()};
+}
+
 }  // namespace ael::dict
@@ -1,22 +1,18 @@
 #include <ael/dictionary/adaptive_d_dictionary.hpp>
-#include <ranges>
 
 namespace ael::dict {
 
-namespace rng = std::ranges;
-
 ////////////////////////////////////////////////////////////////////////////////
-AdaptiveDDictionary::AdaptiveDDictionary(Ord maxOrd)
-    : ael::impl::dict::ADDictionaryBase(maxOrd) {
+AdaptiveDDictionary::AdaptiveDDictionary(
+    Ord maxOrd, ael::impl::dict::CountsLayout layout, Count rescaleThreshold,
+    std::pmr::memory_resource* resource)
+    : ael::impl::dict::ADDictionaryBase(maxOrd, layout, rescaleThreshold,
+                                        resource) {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 auto AdaptiveDDictionary::getWordOrd(Count cumulativeCnt) const -> Ord {
-  const auto getLowerCumulCnt = [this](Ord ord) {
-    return getLowerCumulativeCnt_(ord + 1);
-  };
-  return *rng::upper_bound(this->getOrdRng_(), cumulativeCnt, {},
-                           getLowerCumulCnt);
+  return findWord_(cumulativeCnt).ord;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +22,13 @@ auto AdaptiveDDictionary::getProbabilityStats(Ord ord) -> ProbabilityStats {
   return ret;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+auto AdaptiveDDictionary::decodeSymbol(Count cumulativeCnt) -> DecodedWord {
+  const auto ret = findWord_(cumulativeCnt);
+  this->updateWordCnt_(ret.ord, 1);
+  return ret;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 auto AdaptiveDDictionary::getTotalWordsCnt() const -> Count {
   const auto totalWordsCnt = this->getRealTotalWordsCnt_();
@@ -41,17 +44,23 @@ auto AdaptiveDDictionary::getTotalWordsCnt() const -> Count {
 
 ////////////////////////////////////////////////////////////////////////////////
 auto AdaptiveDDictionary::getLowerCumulativeCnt_(Ord ord) const -> Count {
+  const auto [realLowerCnt, uniqueLowerCnt] = getLowerCumulativeCnts_(ord);
+  return calcLowerCumulativeCnt_(ord, realLowerCnt, uniqueLowerCnt);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto AdaptiveDDictionary::calcLowerCumulativeCnt_(Ord ord, Count realLowerCnt,
+                                                  Count uniqueLowerCnt) const
+    -> Count {
   if (getRealTotalWordsCnt_() == 0) {
     return ord;
   }
   const auto totalUniqueWordsCnt = getTotalWordsUniqueCnt_();
-  const auto cumulativeWordsCnt = getRealLowerCumulativeWordCnt_(ord);
   if (totalUniqueWordsCnt == getMaxOrd_()) {
-    return cumulativeWordsCnt;
+    return realLowerCnt;
   }
-  return (getMaxOrd_() - totalUniqueWordsCnt) * 2 * cumulativeWordsCnt +
-         ord * totalUniqueWordsCnt -
-         getMaxOrd_() * getLowerCumulativeUniqueNumFound_(ord);
+  return (getMaxOrd_() - totalUniqueWordsCnt) * 2 * realLowerCnt +
+         ord * totalUniqueWordsCnt - getMaxOrd_() * uniqueLowerCnt;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -77,4 +86,15 @@ auto AdaptiveDDictionary::getProbabilityStats_(Ord ord) const
   return {low, high, total};
 }
 
+////////////////////////////////////////////////////////////////////////////////
+auto AdaptiveDDictionary::findWord_(Count cumulativeCnt) const
+    -> DecodedWord {
+  const auto calcLowerCumulCnt = [this](Ord ord, Count realLowerCnt,
+                                        Count uniqueLowerCnt) {
+    return calcLowerCumulativeCnt_(ord, realLowerCnt, uniqueLowerCnt);
+  };
+  const auto [ord, low] = findLastNotGreater_(cumulativeCnt, calcLowerCumulCnt);
+  return {ord, low, low + getWordCnt_(ord), getTotalWordsCnt()};
+}
+
 }  // namespace ael::dict
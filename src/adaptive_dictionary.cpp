@@ -1,24 +1,22 @@
 #include <ael/dictionary/adaptive_dictionary.hpp>
-#include <ranges>
 
 namespace ael::dict {
 
-namespace rng = std::ranges;
-
 ////////////////////////////////////////////////////////////////////////////////
 AdaptiveDictionary::AdaptiveDictionary(ConstructInfo constructInfo)
-    : ael::impl::dict::AdaptiveDictionaryBase<Count>(constructInfo.maxOrd,
-                                                     constructInfo.maxOrd),
+    : ael::impl::dict::AdaptiveDictionaryBase<Count>(
+          constructInfo.maxOrd, constructInfo.maxOrd,
+          constructInfo.rescaleThreshold),
       ratio_(constructInfo.ratio),
       maxOrder_(constructInfo.maxOrd) {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 auto AdaptiveDictionary::getWordOrd(Count cumulativeCnt) const -> Ord {
-  const auto getLowerCumulCnt_ = [this](Ord ord) {
-    return getLowerCumulativeCnt_(ord + 1);
+  const auto calcLowerCumulCnt = [this](Ord ord, Count realLowerCnt) {
+    return ord + realLowerCnt * ratio_;
   };
-  return *rng::upper_bound(getOrdRng_(), cumulativeCnt, {}, getLowerCumulCnt_);
+  return findLastNotGreater_(cumulativeCnt, calcLowerCumulCnt).first;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -32,9 +30,9 @@ auto AdaptiveDictionary::getProbabilityStats(Ord ord) -> ProbabilityStats {
 
 ////////////////////////////////////////////////////////////////////////////////
 void AdaptiveDictionary::updateWordCnt_(Ord ord) {
-  this->changeRealCumulativeWordCnt_(ord, 1);
   this->changeRealWordCnt_(ord, 1);
   this->changeRealTotalWordsCnt_(1);
+  this->rescaleIfNeeded_();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
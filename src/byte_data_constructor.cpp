@@ -1,26 +1,77 @@
 #include <ael/byte_data_constructor.hpp>
 #include <algorithm>
+#include <array>
+#include <cassert>
 #include <climits>
-#include <ranges>
 
 namespace ael {
 
+namespace {
+
+constexpr std::size_t wordBits = 64;
+constexpr std::size_t wordBytes = wordBits / CHAR_BIT;
+
+////////////////////////////////////////////////////////////////////////////////
+constexpr std::uint64_t lowBitsMask(std::size_t num) {
+  return (num >= wordBits) ? ~std::uint64_t{0}
+                           : (std::uint64_t{1} << num) - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+std::array<std::byte, wordBytes> storeBigEndian(std::uint64_t word) {
+  auto ret = std::array<std::byte, wordBytes>{};
+  for (std::size_t i = wordBytes; i > 0; --i, word >>= CHAR_BIT) {
+    ret[i - 1] = static_cast<std::byte>(word);
+  }
+  return ret;
+}
+
+}  // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 void ByteDataConstructor::putBit(bool bit) {
-  if (startMask_ == currBitFlag_) {
+  if (currBitOffset_ == 0) {
     data_.push_back(std::byte{0b00000000});
   }
   if (bit) {
-    *data_.rbegin() |= currBitFlag_;
-  } else {
-    *data_.rbegin() &= ~currBitFlag_;
+    data_.back() |= std::byte{0b10000000} >> currBitOffset_;
   }
-  moveBitFlag_();
+  currBitOffset_ = (currBitOffset_ + 1) % CHAR_BIT;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void ByteDataConstructor::putBits(std::uint64_t bits, std::size_t num) {
+  assert(num <= wordBits && "Can not put more than 64 bits at once.");
+  if (num == 0) {
+    return;
+  }
+  bits &= lowBitsMask(num);
+  if (currBitOffset_ != 0) {
+    // Fill the tail of the last partially written byte.
+    const std::size_t freeBits = CHAR_BIT - currBitOffset_;
+    const std::size_t taken = std::min(freeBits, num);
+    const auto head = bits >> (num - taken);
+    data_.back() |= static_cast<std::byte>(head << (freeBits - taken));
+    currBitOffset_ = (currBitOffset_ + taken) % CHAR_BIT;
+    num -= taken;
+    bits &= lowBitsMask(num);
+  }
+  putBitsAligned_(bits, num);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 void ByteDataConstructor::putBitsRepeat(bool bit, std::size_t num) {
-  std::fill_n(getBitBackInserter(), num, bit);
+  const auto pattern = bit ? ~std::uint64_t{0} : std::uint64_t{0};
+  if (currBitOffset_ != 0) {
+    const auto taken =
+        std::min(static_cast<std::size_t>(CHAR_BIT - currBitOffset_), num);
+    putBits(pattern, taken);
+    num -= taken;
+  }
+  const auto wholeBytes = num / CHAR_BIT;
+  data_.insert(data_.end(), wholeBytes,
+               bit ? std::byte{0b11111111} : std::byte{0b00000000});
+  putBitsAligned_(pattern & lowBitsMask(num % CHAR_BIT), num % CHAR_BIT);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -29,18 +80,25 @@ void ByteDataConstructor::putBitsRepeatWithReset(bool bit, std::size_t& num) {
   num = 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+void ByteDataConstructor::putBitThenRepeatOppositeWithReset(bool bit,
+                                                            std::size_t& num) {
+  if (num < wordBits) {
+    const auto oneBit = std::uint64_t{1} << num;
+    putBits(bit ? oneBit : oneBit - 1, num + 1);
+    num = 0;
+    return;
+  }
+  putBit(bit);
+  putBitsRepeatWithReset(!bit, num);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void ByteDataConstructor::putByte(std::byte byteToPut) {
-  if (currBitFlag_ == startMask_) {
+  if (currBitOffset_ == 0) {
     data_.push_back(byteToPut);
   } else {
-    auto bits = std::views::iota(std::size_t{0}, std::size_t{CHAR_BIT}) |
-                std::views::reverse |
-                std::views::transform([byteToPut](std::size_t i) {
-                  return ((byteToPut >> i) & std::byte{1}) == std::byte{1};
-                });
-
-    std::ranges::copy(bits, getBitBackInserter());
+    putBits(std::to_integer<std::uint64_t>(byteToPut), CHAR_BIT);
   }
 }
 
@@ -55,11 +113,19 @@ auto ByteDataConstructor::getByteBackInserter() -> ByteBackInserter {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void ByteDataConstructor::moveBitFlag_() {
-  currBitFlag_ >>= 1;
-  if (std::byte{0b00000000} == currBitFlag_) {
-    currBitFlag_ = startMask_;
+void ByteDataConstructor::putBitsAligned_(std::uint64_t bits,
+                                          std::size_t num) {
+  assert(num == 0 || currBitOffset_ == 0);
+  if (num == 0) {
+    return;
   }
+  // Bits are aligned to the top of a word, which is stored at once, and only
+  // its used bytes are kept.
+  const auto bytes = storeBigEndian(bits << (wordBits - num));
+  const auto usedBytes = (num + CHAR_BIT - 1) / CHAR_BIT;
+  data_.insert(data_.end(), bytes.begin(),
+               bytes.begin() + static_cast<std::ptrdiff_t>(usedBytes));
+  currBitOffset_ = static_cast<std::uint8_t>(num % CHAR_BIT);
 }
 
 }  // namespace ael
@@ -0,0 +1,148 @@
+#include <ael/impl/dictionary/compact_cumulative_count.hpp>
+#include <cassert>
+#include <utility>
+
+namespace ael::impl::dict {
+
+namespace {
+
+using TreeAllocator =
+    std::pmr::polymorphic_allocator<CumulativeRealUniqueCount>;
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+CompactCumulativeCount::CompactCumulativeCount(
+    Ord maxOrd, CountsLayout layout, Count rescaleThreshold,
+    std::pmr::memory_resource* resource)
+    : resource_{resource},
+      rescaleThreshold_{rescaleThreshold},
+      maxOrd_{maxOrd},
+      layout_{layout} {
+}
+
+////////////////////////////////////////////////////////////////////////////////
+CompactCumulativeCount::CompactCumulativeCount(
+    CompactCumulativeCount&& other) noexcept
+    : ords_{other.ords_},
+      cnts_{other.cnts_},
+      totalWordsCnt_{other.totalWordsCnt_},
+      tree_{std::exchange(other.tree_, nullptr)},
+      resource_{other.resource_},
+      rescaleThreshold_{other.rescaleThreshold_},
+      maxOrd_{other.maxOrd_},
+      wordsCnt_{other.wordsCnt_},
+      layout_{other.layout_} {
+}
+
+////////////////////////////////////////////////////////////////////////////////
+CompactCumulativeCount::~CompactCumulativeCount() {
+  if (tree_ != nullptr) {
+    TreeAllocator(resource_).delete_object(tree_);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void CompactCumulativeCount::increaseOrdCount(Ord ord,
+                                              std::int64_t cntChange) {
+  assert(cntChange > 0 && "Real counts are only increased.");
+  const auto cnt = static_cast<Count>(cntChange);
+  if (tree_ != nullptr) {
+    tree_->increaseOrdCount(ord, cnt);
+    return;
+  }
+  auto pos = std::size_t{0};
+  for (; pos < wordsCnt_ && ords_[pos] < ord; ++pos) {
+    // Find the place of the word.
+  }
+  if (pos == wordsCnt_ || ords_[pos] != ord) {
+    if (wordsCnt_ == inlineMaxWordsCnt) {
+      moveToTree_();
+      tree_->increaseOrdCount(ord, cnt);
+      return;
+    }
+    for (auto i = std::size_t{wordsCnt_}; i > pos; --i) {
+      ords_[i] = ords_[i - 1];
+      cnts_[i] = cnts_[i - 1];
+    }
+    ords_[pos] = ord;
+    cnts_[pos] = 0;
+    ++wordsCnt_;
+  }
+  cnts_[pos] += cnt;
+  totalWordsCnt_ += cnt;
+  if (totalWordsCnt_ > rescaleThreshold_) {
+    halveInlineCounts_();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto CompactCumulativeCount::getLowerCumulativeCnt(Ord ord) const -> Count {
+  if (tree_ != nullptr) {
+    return tree_->getLowerCumulativeCnts(ord).real;
+  }
+  auto ret = Count{0};
+  for (std::size_t i = 0; i < wordsCnt_ && ords_[i] < ord; ++i) {
+    ret += cnts_[i];
+  }
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto CompactCumulativeCount::getCount(Ord ord) const -> Count {
+  if (tree_ != nullptr) {
+    return tree_->getRealCount(ord);
+  }
+  for (std::size_t i = 0; i < wordsCnt_ && ords_[i] <= ord; ++i) {
+    if (ords_[i] == ord) {
+      return cnts_[i];
+    }
+  }
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto CompactCumulativeCount::getLowerUniqueCnt(Ord ord) const -> Count {
+  if (tree_ != nullptr) {
+    return tree_->getLowerCumulativeCnts(ord).unique;
+  }
+  auto ret = Count{0};
+  for (; ret < wordsCnt_ && ords_[ret] < ord; ++ret) {
+    // Count met words before `ord`.
+  }
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto CompactCumulativeCount::getNthUnmetOrd(Count num) const -> Ord {
+  if (tree_ != nullptr) {
+    return tree_->getNthUnmetOrd(num);
+  }
+  // Each met word not after the candidate shifts it by one.
+  auto ret = Ord{num};
+  for (std::size_t i = 0; i < wordsCnt_ && ords_[i] <= ret; ++i) {
+    ++ret;
+  }
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void CompactCumulativeCount::moveToTree_() {
+  tree_ = TreeAllocator(resource_).new_object<CumulativeRealUniqueCount>(
+      maxOrd_, layout_, rescaleThreshold_, resource_);
+  // Inline total does not exceed the threshold, so nothing is rescaled here.
+  for (std::size_t i = 0; i < wordsCnt_; ++i) {
+    tree_->increaseOrdCount(ords_[i], cnts_[i]);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void CompactCumulativeCount::halveInlineCounts_() {
+  for (std::size_t i = 0; i < wordsCnt_; ++i) {
+    const auto decrease = cnts_[i] / 2;
+    cnts_[i] -= decrease;
+    totalWordsCnt_ -= decrease;
+  }
+}
+
+}  // namespace ael::impl::dict
@@ -0,0 +1,121 @@
+#include <ael/impl/dictionary/ctx_tree.hpp>
+
+namespace ael::impl::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+CtxLinks::CtxLinks(std::size_t ctxLength) : ctxLength_{ctxLength} {
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void CtxLinks::update(Ord ord) {
+  if (ctxLength_ == 0) {
+    return;
+  }
+  auto prefix = (getLength(currNode_) < ctxLength_) ? currNode_
+                                                    : nodes_[currNode_].suffix;
+  if (!frozen_) {
+    currNode_ = getSuccessor_(prefix, ord);
+  } else {
+    for (currNode_ = findSuccessor_(prefix, ord);
+         currNode_ == noNode && prefix != root;
+         currNode_ = findSuccessor_(prefix, ord)) {
+      prefix = nodes_[prefix].suffix;
+    }
+    if (currNode_ == noNode) {
+      currNode_ = root;
+    }
+  }
+  auto& hits = nodes_[currNode_].hits;
+  hits += (hits != std::numeric_limits<std::uint32_t>::max()) ? 1 : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void CtxLinks::reset() {
+  // Containers give their storage back before the pool returns its memory
+  // upstream, so a restarted model is as small as a new one.
+  std::pmr::vector<Node_>(getResource()).swap(nodes_);
+  Successors_(getResource()).swap(successors_);
+  resource_->release();
+  nodes_.push_back({root, root, 0, 0});
+  currNode_ = root;
+  frozen_ = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto CtxLinks::prune_(std::size_t maxNodesCnt) -> std::vector<Node> {
+  assert(maxNodesCnt != 0 && "Empty context can not be removed.");
+  const auto metCnts = getMetCnts_();
+  auto newNodes = std::vector<Node>(nodes_.size(), noNode);
+  auto newNodesCnt = Node{1};
+  for (auto threshold = std::uint64_t{1};; threshold *= 2) {
+    newNodesCnt = 1;
+    newNodes[root] = root;
+    for (Node node = 1; node < nodes_.size(); ++node) {
+      const auto& [suffix, prefix, length, hits] = nodes_[node];
+      const auto removed = metCnts[node] < threshold ||
+                           newNodes[suffix] == noNode ||
+                           newNodes[prefix] == noNode;
+      newNodes[node] = removed ? noNode : newNodesCnt++;
+    }
+    if (newNodesCnt <= maxNodesCnt) {
+      break;
+    }
+  }
+  for (; newNodes[currNode_] == noNode; currNode_ = nodes_[currNode_].suffix) {
+    // Move to the longest left suffix.
+  }
+  currNode_ = newNodes[currNode_];
+  for (Node node = 1; node < nodes_.size(); ++node) {
+    if (const auto newNode = newNodes[node]; newNode != noNode) {
+      const auto& [suffix, prefix, length, hits] = nodes_[node];
+      nodes_[newNode] = {newNodes[suffix], newNodes[prefix], length, hits / 2};
+    }
+  }
+  nodes_.resize(newNodesCnt);
+  auto successors = Successors_(getResource());
+  for (const auto& [key, successor] : successors_) {
+    if (const auto newSuccessor = newNodes[successor]; newSuccessor != noNode) {
+      successors.emplace(SuccessorKey_{newNodes[key.node], key.ord},
+                         newSuccessor);
+    }
+  }
+  successors_ = std::move(successors);
+  return newNodes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto CtxLinks::getSuccessor_(Node node, Ord ord) -> Node {
+  if (const auto successorIt = successors_.find({node, ord});
+      successorIt != successors_.end()) {
+    return successorIt->second;
+  }
+  // Suffix of the successor is the successor of the suffix.
+  const auto suffix =
+      (node == root) ? root : getSuccessor_(nodes_[node].suffix, ord);
+  const auto ret = static_cast<Node>(nodes_.size());
+  nodes_.push_back(
+      {suffix, node, static_cast<std::uint16_t>(nodes_[node].length + 1), 0});
+  successors_.emplace(SuccessorKey_{node, ord}, ret);
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto CtxLinks::findSuccessor_(Node node, Ord ord) const -> Node {
+  const auto successorIt = successors_.find({node, ord});
+  return successorIt == successors_.end() ? noNode : successorIt->second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto CtxLinks::getMetCnts_() const -> std::vector<std::uint64_t> {
+  // A context is met, when it or a context, which it is a suffix of, is the
+  // longest current one. Suffixes have smaller numbers, so counts are pushed
+  // from the last node down.
+  auto ret = std::vector<std::uint64_t>(nodes_.size());
+  for (auto node = nodes_.size() - 1; node != 0; --node) {
+    ret[node] += nodes_[node].hits;
+    ret[nodes_[node].suffix] += ret[node];
+  }
+  return ret;
+}
+
+}  // namespace ael::impl::dict
@@ -0,0 +1,55 @@
+#include <ael/impl/dictionary/cumulative_real_unique_count.hpp>
+
+namespace ael::impl::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+CumulativeRealUniqueCount::CumulativeRealUniqueCount(
+    Ord maxOrd, CountsLayout layout, Count rescaleThreshold,
+    std::pmr::memory_resource* resource)
+    : cnts_(maxOrd, layout, resource),
+      rescaleThreshold_{rescaleThreshold},
+      maxOrd_{maxOrd} {
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void CumulativeRealUniqueCount::increaseOrdCount(Ord ord, Count cnt) {
+  const auto uniqueChange = Count{getRealCount(ord) == 0 ? 1U : 0U};
+  cnts_.update(ord, {cnt, uniqueChange});
+  realTotalWordsCnt_ += cnt;
+  uniqueTotalWordsCnt_ += uniqueChange;
+  if (realTotalWordsCnt_ > rescaleThreshold_) {
+    halveCounts();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void CumulativeRealUniqueCount::halveCounts() {
+  // Unique counts of met words stay one.
+  const auto decrease = cnts_.changeCounts([](Counts& cnts) {
+    const auto realDecrease = cnts.real / 2;
+    cnts.real -= realDecrease;
+    return Counts{realDecrease, 0};
+  });
+  realTotalWordsCnt_ -= decrease.real;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto CumulativeRealUniqueCount::getNthUnmetOrd(Count num) const -> Ord {
+  // Binary lifting search for the last ord with `num` unmet words before it.
+  auto ord = Ord{0};
+  auto unmetCnt = Count{0};
+  for (auto step = getSearchStep(); step != 0; step >>= 1) {
+    const auto next = ord + step;
+    if (next > maxOrd_) {
+      continue;
+    }
+    if (const auto nextUnmetCnt = unmetCnt + step - getNodeCnts(next).unique;
+        nextUnmetCnt <= num) {
+      ord = next;
+      unmetCnt = nextUnmetCnt;
+    }
+  }
+  return ord;
+}
+
+}  // namespace ael::impl::dict
@@ -1,62 +1,104 @@
 #include <ael/data_parser.hpp>
 #include <ael/impl/byte_rng_to_bits.hpp>
+#include <cassert>
 #include <climits>
 #include <cstddef>
-#include <ranges>
 
 namespace ael {
 
+namespace {
+
+constexpr std::size_t wordBits = 64;
+constexpr std::size_t wordBytes = wordBits / CHAR_BIT;
+
+////////////////////////////////////////////////////////////////////////////////
+std::uint64_t loadBigEndian(const std::byte* ptr) {
+  auto ret = std::uint64_t{0};
+  for (std::size_t i = 0; i < wordBytes; ++i) {
+    ret = (ret << CHAR_BIT) | std::to_integer<std::uint64_t>(ptr[i]);
+  }
+  return ret;
+}
+
+}  // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 DataParser::DataParser(std::span<const std::byte> data)
-    : data_(data), bitsView_{impl::to_bits(data_)}, dataIter_{data_.begin()} {
+    : data_(data), bitsView_{impl::to_bits(data_)} {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 std::byte DataParser::takeByte() {
-  if (inByteOffset_ == 0) {
-    const std::byte ret = *dataIter_;
-    ++dataIter_;
-    return ret;
-  }
-  auto ret = std::byte{0};
-  for ([[maybe_unused]] const auto _ : std::ranges::iota_view(0, 8)) {
-    ret <<= 1;
-    ret |= takeBit() ? std::byte{0b00000001} : std::byte{0b00000000};
-  }
-  return ret;
+  return static_cast<std::byte>(takeBits(CHAR_BIT));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 bool DataParser::takeBit() {
-  if (dataIter_ >= data_.end()) {
-    return false;
+  return takeBits(1) != 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+std::uint64_t DataParser::peekBits(std::size_t num) {
+  assert(num <= maxBitsAtOnce && "Too many bits to peek at once.");
+  if (bufferedBitsCnt_ < num) {
+    refill_();
   }
-  const auto ret =
-      bool{bitsView_[(dataIter_ - data_.begin()) * CHAR_BIT + inByteOffset_]};
-  moveInByteOffset_();
+  return (num == 0) ? 0 : bitsBuffer_ >> (wordBits - num);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+std::uint64_t DataParser::takeBits(std::size_t num) {
+  const auto ret = peekBits(num);
+  bitsBuffer_ = (num == 0) ? bitsBuffer_ : bitsBuffer_ << num;
+  bufferedBitsCnt_ -= num;
   return ret;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void DataParser::moveInByteOffset_() {
-  ++inByteOffset_;
-  if (inByteOffset_ == CHAR_BIT) {
-    inByteOffset_ = 0;
-    ++dataIter_;
+void DataParser::skipBits(std::size_t num) {
+  if (num > bufferedBitsCnt_) {
+    seek(getBitsOffset_() + num);
+    return;
+  }
+  bitsBuffer_ = (num == wordBits) ? 0 : bitsBuffer_ << num;
+  bufferedBitsCnt_ -= num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void DataParser::refill_() {
+  if (nextByteIdx_ + wordBytes <= data_.size()) {
+    // Branch-free refill: load a whole word and keep only fitting bytes.
+    bitsBuffer_ |=
+        loadBigEndian(data_.data() + nextByteIdx_) >> bufferedBitsCnt_;
+    nextByteIdx_ += (wordBits - 1 - bufferedBitsCnt_) / CHAR_BIT;
+    bufferedBitsCnt_ |= maxBitsAtOnce;
+    return;
+  }
+  // Tail: bytes after the end of data are implicit zeros.
+  while (bufferedBitsCnt_ <= maxBitsAtOnce) {
+    if (nextByteIdx_ < data_.size()) {
+      bitsBuffer_ |= std::to_integer<std::uint64_t>(data_[nextByteIdx_])
+                     << (maxBitsAtOnce - bufferedBitsCnt_);
+    }
+    ++nextByteIdx_;
+    bufferedBitsCnt_ += CHAR_BIT;
   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 DataParser& DataParser::seek(std::size_t bitsOffset) {
-  dataIter_ = data_.begin() + static_cast<ptrdiff_t>(bitsOffset / CHAR_BIT);
-  inByteOffset_ = bitsOffset % CHAR_BIT;
+  nextByteIdx_ = bitsOffset / CHAR_BIT;
+  bitsBuffer_ = 0;
+  bufferedBitsCnt_ = 0;
+  takeBits(bitsOffset % CHAR_BIT);
   return *this;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 bool operator==(const DataParser& dp1, const DataParser& dp2) {
   return dp1.data_.data() == dp2.data_.data() &&
-         dp1.data_.size() == dp2.data_.size() && dp1.dataIter_ == dp2.dataIter_;
+         dp1.data_.size() == dp2.data_.size() &&
+         dp1.getBitsOffset_() / CHAR_BIT == dp2.getBitsOffset_() / CHAR_BIT;
 }
 
 }  // namespace ael
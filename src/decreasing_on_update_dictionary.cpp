@@ -1,11 +1,9 @@
 #include <ael/dictionary/decreasing_on_update_dictionary.hpp>
-#include <algorithm>
+#include <cassert>
 #include <ranges>
 
 namespace ael::dict {
 
-namespace rng = std::ranges;
-
 ////////////////////////////////////////////////////////////////////////////////
 DecreasingOnUpdateDictionary::DecreasingOnUpdateDictionary(Ord maxOrd,
                                                            Count count)
@@ -13,17 +11,16 @@ DecreasingOnUpdateDictionary::DecreasingOnUpdateDictionary(Ord maxOrd,
       maxOrd_(maxOrd) {
   for (const auto ord : std::ranges::iota_view(Ord{0}, maxOrd_)) {
     changeRealWordCnt_(ord, static_cast<std::int64_t>(count));
-    changeRealCumulativeWordCnt_(ord, static_cast<std::int64_t>(count));
   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 auto DecreasingOnUpdateDictionary::getWordOrd(Count cumulativeCnt) const
     -> Ord {
-  const auto getLowerCumulCnt_ = [this](Ord ord) {
-    return getLowerCumulativeCnt_(ord + 1);
+  const auto calcLowerCumulCnt = [](Ord /*ord*/, Count realLowerCnt) {
+    return realLowerCnt;
   };
-  return *rng::upper_bound(getOrdRng_(), cumulativeCnt, {}, getLowerCumulCnt_);
+  return findLastNotGreater_(cumulativeCnt, calcLowerCumulCnt).first;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -37,8 +34,7 @@ auto DecreasingOnUpdateDictionary::getProbabilityStats(Ord ord)
 ////////////////////////////////////////////////////////////////////////////////
 void DecreasingOnUpdateDictionary::updateWordCnt_(Ord ord, Count cnt) {
   changeRealTotalWordsCnt_(-1);
-  changeRealCumulativeWordCnt_(ord, -static_cast<std::int64_t>(cnt));
-  changeRealWordCnt_(ord, -1);
+  changeRealWordCnt_(ord, -static_cast<std::int64_t>(cnt));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
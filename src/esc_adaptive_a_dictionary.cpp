@@ -1,13 +1,12 @@
 #include <ael/esc/dictionary/adaptive_a_dictionary.hpp>
-#include <ranges>
 
 namespace ael::esc::dict {
 
-namespace rng = std::ranges;
-
 ////////////////////////////////////////////////////////////////////////////////
-AdaptiveADictionary::AdaptiveADictionary(Ord maxOrd)
-    : ael::impl::esc::dict::ADDictionaryBase(maxOrd) {
+AdaptiveADictionary::AdaptiveADictionary(Ord maxOrd,
+                                         Count rescaleThreshold)
+    : ael::impl::esc::dict::ADDictionaryBase(
+          maxOrd, ael::impl::dict::CountsLayout::automatic, rescaleThreshold) {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -19,10 +18,11 @@ auto AdaptiveADictionary::getWordOrd(Count cumulativeCnt) const -> Ord {
   if (cumulativeCnt == getRealTotalWordsCnt_()) {
     return getMaxOrd_();
   }
-  const auto getLowerCumulCnt_ = [this](Ord ord) {
-    return getRealLowerCumulativeWordCnt_(ord + 1);
+  const auto calcLowerCumulCnt = [](Ord /*ord*/, Count realLowerCnt,
+                                    Count /*uniqueLowerCnt*/) {
+    return realLowerCnt;
   };
-  return *rng::upper_bound(getOrdRng_(), cumulativeCnt, {}, getLowerCumulCnt_);
+  return findLastNotGreater_(cumulativeCnt, calcLowerCumulCnt).first;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -53,10 +53,7 @@ auto AdaptiveADictionary::getTotalWordsCnt() const -> Count {
 ////////////////////////////////////////////////////////////////////////////////
 auto AdaptiveADictionary::getWordOrdAfterEsc_(Count cumulativeCnt) const
     -> Ord {
-  const auto getLowerCumulCnt_ = [this](Ord ord) {
-    return ord + 1 - getLowerCumulativeUniqueNumFound_(ord + 1);
-  };
-  return *rng::upper_bound(getOrdRng_(), cumulativeCnt, {}, getLowerCumulCnt_);
+  return getNthUnmetOrd_(cumulativeCnt);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1,13 +1,12 @@
 #include <ael/esc/dictionary/adaptive_d_dictionary.hpp>
-#include <ranges>
 
 namespace ael::esc::dict {
 
-namespace rng = std::ranges;
-
 ////////////////////////////////////////////////////////////////////////////////
-AdaptiveDDictionary::AdaptiveDDictionary(Ord maxOrd)
-    : ael::impl::esc::dict::ADDictionaryBase(maxOrd) {
+AdaptiveDDictionary::AdaptiveDDictionary(Ord maxOrd,
+                                         Count rescaleThreshold)
+    : ael::impl::esc::dict::ADDictionaryBase(
+          maxOrd, ael::impl::dict::CountsLayout::automatic, rescaleThreshold) {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -24,11 +23,11 @@ auto AdaptiveDDictionary::getWordOrd(Count cumulativeCnt) const -> Ord {
       getRealTotalWordsCnt_() * 2 - getTotalWordsUniqueCnt_()) {
     return getMaxOrd_();
   }
-  const auto getLowerCumulCnt = [this](Ord ord) {
-    return getRealLowerCumulativeWordCnt_(ord + 1) * 2 -
-           getLowerCumulativeUniqueNumFound_(ord + 1);
+  const auto calcLowerCumulCnt = [](Ord /*ord*/, Count realLowerCnt,
+                                    Count uniqueLowerCnt) {
+    return realLowerCnt * 2 - uniqueLowerCnt;
   };
-  return *rng::upper_bound(getOrdRng_(), cumulativeCnt, {}, getLowerCumulCnt);
+  return findLastNotGreater_(cumulativeCnt, calcLowerCumulCnt).first;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -62,10 +61,7 @@ auto AdaptiveDDictionary::getTotalWordsCnt() const -> Count {
 ////////////////////////////////////////////////////////////////////////////////
 auto AdaptiveDDictionary::getWordOrdAfterEsc_(Count cumulativeCnt) const
     -> Ord {
-  const auto getLowerCumulCnt_ = [this](std::uint64_t ord) {
-    return ord + 1 - getLowerCumulativeUniqueNumFound_(ord + 1);
-  };
-  return *rng::upper_bound(getOrdRng_(), cumulativeCnt, {}, getLowerCumulCnt_);
+  return getNthUnmetOrd_(cumulativeCnt);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -73,8 +69,8 @@ auto AdaptiveDDictionary::getProbabilityStats_(Ord ord) const -> StatsSeq {
   if (getRealWordCnt_(ord) == 0) {
     return getProbabilityStatsForNewWord_(ord);
   }
-  const auto symLow = getRealLowerCumulativeWordCnt_(ord) * 2 -
-                      getLowerCumulativeUniqueNumFound_(ord);
+  const auto [realLowerCnt, uniqueLowerCnt] = getLowerCumulativeCnts_(ord);
+  const auto symLow = realLowerCnt * 2 - uniqueLowerCnt;
   const auto symHigh = symLow + getRealWordCnt_(ord) * 2 - 1;
   const auto symTotal = getRealTotalWordsCnt_() * 2;
 
@@ -102,8 +98,8 @@ auto AdaptiveDDictionary::getDecodeProbabilityStats_(Ord ord)
     const auto symTotal = getMaxOrd_() - getTotalWordsUniqueCnt_();
     return {symLow, symHigh, symTotal};
   }
-  const auto symLow = 2 * getRealLowerCumulativeWordCnt_(ord) -
-                      getLowerCumulativeUniqueNumFound_(ord);
+  const auto [realLowerCnt, uniqueLowerCnt] = getLowerCumulativeCnts_(ord);
+  const auto symLow = 2 * realLowerCnt - uniqueLowerCnt;
   const auto symHigh = symLow + 2 * getRealWordCnt_(ord) - 1;
   const auto symTotal = 2 * getRealTotalWordsCnt_();
   return {symLow, symHigh, symTotal};
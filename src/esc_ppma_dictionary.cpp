@@ -8,10 +8,13 @@ namespace rng = std::ranges;
 
 ////////////////////////////////////////////////////////////////////////////////
 PPMADictionary::PPMADictionary(ConstructInfo constructInfo)
-    : ael::impl::esc::dict::PPMADDictionaryBase<PPMADictionary>(constructInfo.maxOrd,
-                                                constructInfo.ctxLength),
-      zeroCtxCnt_(constructInfo.maxOrd),
-      zeroCtxUniqueCnt_(constructInfo.maxOrd) {
+    : ael::impl::esc::dict::PPMADDictionaryBase<PPMADictionary>(
+          constructInfo.maxOrd, constructInfo.ctxLength,
+          constructInfo.rescaleThreshold, constructInfo.maxCtxsCnt,
+          constructInfo.ctxsLimitPolicy),
+      zeroCtxCnt_(constructInfo.maxOrd, impl::dict::CountsLayout::automatic,
+                  constructInfo.rescaleThreshold),
+      ctxInfo_(constructInfo.ctxLength) {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -31,9 +34,9 @@ auto PPMADictionary::getWordOrd(Count cumulativeCnt) const -> Ord {
 auto PPMADictionary::getProbabilityStats(Ord ord) -> StatsSeq {
   StatsSeq ret;
   auto currCtx = getInitSearchCtx_();
-  updateCtx_(ord);  // ctx_ is never read later
   for (; !currCtx.empty() && !ctxInfo_.contains(currCtx); currCtx.pop_back()) {
-    ctxInfo_.emplace(currCtx, getMaxOrd_());
+    ctxInfo_.emplace(currCtx, getMaxOrd_(), impl::dict::CountsLayout::sparse,
+                     getRescaleThreshold_(), ctxInfo_.getResource());
     ctxInfo_.at(currCtx).increaseOrdCount(ord, 1);
   }
   for (; !currCtx.empty() && ctxInfo_.at(currCtx).getCount(ord) == 0;
@@ -52,10 +55,10 @@ auto PPMADictionary::getProbabilityStats(Ord ord) -> StatsSeq {
       const auto escHigh = escLow + 1;
       const auto escTotal = zeroTotal + 1;
       ret.emplace_back(escLow, escHigh, escTotal);
-      const auto zeroLower = zeroCtxUniqueCnt_.getLowerCumulativeCnt(ord);
+      const auto zeroLower = zeroCtxCnt_.getLowerUniqueCnt(ord);
       const auto symLow = Count{ord} - zeroLower;
       const auto symHigh = symLow + 1;
-      const auto symTotal = getMaxOrd_() - zeroCtxUniqueCnt_.getTotalWordsCnt();
+      const auto symTotal = getMaxOrd_() - zeroCtxCnt_.getUniqueTotalWordsCnt();
       ret.emplace_back(symLow, symHigh, symTotal);
     } else {
       const auto symLow = zeroCtxCnt_.getLowerCumulativeCnt(ord);
@@ -63,22 +66,19 @@ auto PPMADictionary::getProbabilityStats(Ord ord) -> StatsSeq {
       const auto symTotal = zeroTotal + 1;
       ret.emplace_back(symLow, symHigh, symTotal);
     }
-
-    zeroCtxCnt_.increaseOrdCount(ord, 1);
-    zeroCtxUniqueCnt_.update(ord);
-
-    return ret;
-  }
-  const auto& currCtxInfo = ctxInfo_.at(currCtx);
-  const auto symLow = currCtxInfo.getLowerCumulativeCnt(ord);
-  const auto symHigh = symLow + currCtxInfo.getCount(ord);
-  const auto symTotal = currCtxInfo.getTotalWordsCnt() + 1;
-  ret.emplace_back(symLow, symHigh, symTotal);
-  for (; !currCtx.empty(); currCtx.pop_back()) {
-    ctxInfo_.at(currCtx).increaseOrdCount(ord, 1);
+  } else {
+    const auto& currCtxInfo = ctxInfo_.at(currCtx);
+    const auto symLow = currCtxInfo.getLowerCumulativeCnt(ord);
+    const auto symHigh = symLow + currCtxInfo.getCount(ord);
+    const auto symTotal = currCtxInfo.getTotalWordsCnt() + 1;
+    ret.emplace_back(symLow, symHigh, symTotal);
+    for (; !currCtx.empty(); currCtx.pop_back()) {
+      ctxInfo_.at(currCtx).increaseOrdCount(ord, 1);
+    }
   }
   zeroCtxCnt_.increaseOrdCount(ord, 1);
-  zeroCtxUniqueCnt_.update(ord);
+  // Contexts limit may drop contexts, so it goes after currCtx is used.
+  updateCtx_(ord);
   return ret;
 }
 
@@ -104,7 +104,7 @@ auto PPMADictionary::getTotalWordsCnt() const -> Count {
   }
   assert(getEscDecoded_() == currCtx.size() + 1 &&
          "Esc decode count can not be that big.");
-  return getMaxOrd_() - zeroCtxUniqueCnt_.getTotalWordsCnt();
+  return getMaxOrd_() - zeroCtxCnt_.getUniqueTotalWordsCnt();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -149,9 +149,9 @@ auto PPMADictionary::getDecodeProbabilityStats_(Ord ord) -> ProbabilityStats {
 ////////////////////////////////////////////////////////////////////////////////
 auto PPMADictionary::getDecodeProbabilityStatsForNewWord_(Ord ord) const
     -> ProbabilityStats {
-  const auto symLow = Count{ord} - zeroCtxUniqueCnt_.getLowerCumulativeCnt(ord);
+  const auto symLow = Count{ord} - zeroCtxCnt_.getLowerUniqueCnt(ord);
   const auto symHigh = symLow + 1;
-  const auto symTotal = getMaxOrd_() - zeroCtxUniqueCnt_.getTotalWordsCnt();
+  const auto symTotal = getMaxOrd_() - zeroCtxCnt_.getUniqueTotalWordsCnt();
   return {symLow, symHigh, symTotal};
 }
 
@@ -159,24 +159,20 @@ auto PPMADictionary::getDecodeProbabilityStatsForNewWord_(Ord ord) const
 void PPMADictionary::updateWordCnt_(Ord ord, std::int64_t cntChange) {
   auto currCtx = getInitSearchCtx_();
   for (; !currCtx.empty() && !ctxInfo_.contains(currCtx); currCtx.pop_back()) {
-    auto [iter, insertionHappened] = ctxInfo_.emplace(currCtx, getMaxOrd_());
-    assert(insertionHappened && "Insertion must has happened here.");
-    iter->second.increaseOrdCount(ord, cntChange);
+    auto& cell = ctxInfo_.emplace(
+        currCtx, getMaxOrd_(), impl::dict::CountsLayout::sparse,
+        getRescaleThreshold_(), ctxInfo_.getResource());
+    cell.increaseOrdCount(ord, cntChange);
   }
   for (; !currCtx.empty(); currCtx.pop_back()) {
     ctxInfo_.at(currCtx).increaseOrdCount(ord, cntChange);
   }
   zeroCtxCnt_.increaseOrdCount(ord, cntChange);
-  zeroCtxUniqueCnt_.update(ord);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 auto PPMADictionary::getWordOrdForNewWord_(Count cumulativeCnt) const -> Ord {
-  const auto getLowerCumulCnt = [this](Ord ord) {
-    return ord + 1 - zeroCtxUniqueCnt_.getLowerCumulativeCnt(ord + 1);
-  };
-  const auto retOrd =
-      *rng::upper_bound(getOrdRng_(), cumulativeCnt, {}, getLowerCumulCnt);
+  const auto retOrd = zeroCtxCnt_.getNthUnmetOrd(cumulativeCnt);
   assert(!isEsc(retOrd) &&
          "Search in symbols which were not found yet. Esc is invalid here.");
   return retOrd;
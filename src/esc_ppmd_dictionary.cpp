@@ -9,22 +9,26 @@ namespace rng = std::ranges;
 ////////////////////////////////////////////////////////////////////////////////
 PPMDDictionary::PPMDDictionary(ConstructInfo constructInfo)
     : ael::impl::esc::dict::PPMADDictionaryBase<PPMDDictionary>(
-          constructInfo.maxOrd, constructInfo.ctxLength),
-      zeroCtxCell_(constructInfo.maxOrd) {
+          constructInfo.maxOrd, constructInfo.ctxLength,
+          constructInfo.rescaleThreshold, constructInfo.maxCtxsCnt,
+          constructInfo.ctxsLimitPolicy),
+      zeroCtxCell_(constructInfo.maxOrd, impl::dict::CountsLayout::automatic,
+                   constructInfo.rescaleThreshold),
+      ctxInfo_(constructInfo.ctxLength) {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 auto PPMDDictionary::getWordOrd(Count cumulativeCnt) const -> Ord {
   auto currCtx = getSearchCtxEmptySkipped_();
-  if (0 == zeroCtxCell_.cnt.getTotalWordsCnt() &&
+  if (0 == zeroCtxCell_.getTotalWordsCnt() &&
       getEscDecoded_() == currCtx.size()) [[unlikely]] {
     return getMaxOrd_();
   }
   if (getEscDecoded_() <= currCtx.size()) {
     const auto& cell = getCurrCtxCell_(currCtx);
     const auto getLowerCumulCnt = [&cell](Ord ord) {
-      return 2 * cell.cnt.getLowerCumulativeCnt(ord + 1) -
-             cell.uniqueCnt.getLowerCumulativeCnt(ord + 1);
+      return 2 * cell.getLowerCumulativeCnt(ord + 1) -
+             cell.getLowerUniqueCnt(ord + 1);
     };
     return *rng::upper_bound(getOrdRng_(), cumulativeCnt, {}, getLowerCumulCnt);
   }
@@ -35,33 +39,30 @@ auto PPMDDictionary::getWordOrd(Count cumulativeCnt) const -> Ord {
 auto PPMDDictionary::getProbabilityStats(Ord ord) -> StatsSeq {
   StatsSeq ret;
   auto currCtx = getInitSearchCtx_();
-  updateCtx_(ord);
   for (; !currCtx.empty() && !ctxInfo_.contains(currCtx); currCtx.pop_back()) {
-    auto [iter, insertionHappened] = ctxInfo_.emplace(currCtx, getMaxOrd_());
-    assert(insertionHappened && "Insertion must happen.");
-    iter->second.cnt.increaseOrdCount(ord, 1);
-    iter->second.uniqueCnt.update(ord);
+    auto& cell = ctxInfo_.emplace(
+        currCtx, getMaxOrd_(), impl::dict::CountsLayout::sparse,
+        getRescaleThreshold_(), ctxInfo_.getResource());
+    cell.increaseOrdCount(ord, 1);
   }
   for (; !currCtx.empty(); currCtx.pop_back()) {
     auto& currCtxInfo = ctxInfo_.at(currCtx);
-    if (currCtxInfo.cnt.getCount(ord) > 0) {
+    if (currCtxInfo.getCount(ord) > 0) {
       break;
     }
-    const auto currTotal = currCtxInfo.cnt.getTotalWordsCnt();
-    const auto currTotalUnique = currCtxInfo.uniqueCnt.getTotalWordsCnt();
+    const auto currTotal = currCtxInfo.getTotalWordsCnt();
+    const auto currTotalUnique = currCtxInfo.getUniqueTotalWordsCnt();
     const auto escLow = 2 * currTotal - currTotalUnique;
     const auto escHigh = escLow + currTotalUnique;
     const auto escTotal = 2 * currTotal;
     ret.emplace_back(escLow, escHigh, escTotal);
-    currCtxInfo.cnt.increaseOrdCount(ord, 1);
-    currCtxInfo.uniqueCnt.update(ord);
+    currCtxInfo.increaseOrdCount(ord, 1);
   }
   if (currCtx.empty()) {
-    const auto zeroTotal = zeroCtxCell_.cnt.getTotalWordsCnt();
-    const auto zeroLowerUnique =
-        zeroCtxCell_.uniqueCnt.getLowerCumulativeCnt(ord);
-    if (const auto zeroCount = zeroCtxCell_.cnt.getCount(ord); 0 == zeroCount) {
-      const auto zeroTotalUnique = zeroCtxCell_.uniqueCnt.getTotalWordsCnt();
+    const auto zeroTotal = zeroCtxCell_.getTotalWordsCnt();
+    const auto zeroLowerUnique = zeroCtxCell_.getLowerUniqueCnt(ord);
+    if (const auto zeroCount = zeroCtxCell_.getCount(ord); 0 == zeroCount) {
+      const auto zeroTotalUnique = zeroCtxCell_.getUniqueTotalWordsCnt();
       const auto escLow = 2 * zeroTotal - zeroTotalUnique;
       const auto escHigh = escLow + std::max(Count{1}, zeroTotalUnique);
       const auto escTotal = std::max(Count{1}, 2 * zeroTotal);
@@ -71,8 +72,8 @@ auto PPMDDictionary::getProbabilityStats(Ord ord) -> StatsSeq {
       const auto symTotal = getMaxOrd_() - zeroTotalUnique;
       ret.emplace_back(symLow, symHigh, symTotal);
     } else {
-      const auto zeroLower = zeroCtxCell_.cnt.getLowerCumulativeCnt(ord);
-      const auto zeroUnique = zeroCtxCell_.uniqueCnt.getCount(ord);
+      const auto zeroLower = zeroCtxCell_.getLowerCumulativeCnt(ord);
+      const auto zeroUnique = zeroCtxCell_.getUniqueCount(ord);
       const auto symLow = 2 * zeroLower - zeroLowerUnique;
       const auto symHigh = symLow + 2 * zeroCount - zeroUnique;
       const auto symTotal = 2 * zeroTotal;
@@ -80,23 +81,22 @@ auto PPMDDictionary::getProbabilityStats(Ord ord) -> StatsSeq {
     }
   } else {
     const auto& currCtxInfo = ctxInfo_.at(currCtx);
-    const auto lowerCnt = currCtxInfo.cnt.getLowerCumulativeCnt(ord);
-    const auto lowerUniqueCnt =
-        currCtxInfo.uniqueCnt.getLowerCumulativeCnt(ord);
+    const auto lowerCnt = currCtxInfo.getLowerCumulativeCnt(ord);
+    const auto lowerUniqueCnt = currCtxInfo.getLowerUniqueCnt(ord);
     const auto symLow = 2 * lowerCnt - lowerUniqueCnt;
-    const auto cnt = currCtxInfo.cnt.getCount(ord);
-    const auto uniqueCnt = currCtxInfo.uniqueCnt.getCount(ord);
+    const auto cnt = currCtxInfo.getCount(ord);
+    const auto uniqueCnt = currCtxInfo.getUniqueCount(ord);
     const auto symHigh = symLow + 2 * cnt - uniqueCnt;
-    const auto symTotal = 2 * currCtxInfo.cnt.getTotalWordsCnt();
+    const auto symTotal = 2 * currCtxInfo.getTotalWordsCnt();
     ret.emplace_back(symLow, symHigh, symTotal);
     for (; !currCtx.empty(); currCtx.pop_back()) {
       auto& currCtxInfo = ctxInfo_.at(currCtx);
-      currCtxInfo.cnt.increaseOrdCount(ord, 1);
-      currCtxInfo.uniqueCnt.update(ord);
+      currCtxInfo.increaseOrdCount(ord, 1);
     }
   }
-  zeroCtxCell_.cnt.increaseOrdCount(ord, 1);
-  zeroCtxCell_.uniqueCnt.update(ord);
+  zeroCtxCell_.increaseOrdCount(ord, 1);
+  // Contexts limit may drop contexts, so it goes after currCtx is used.
+  updateCtx_(ord);
   return ret;
 }
 
@@ -115,14 +115,14 @@ auto PPMDDictionary::getTotalWordsCnt() const -> Count {
   auto currCtx = getSearchCtxEmptySkipped_();
   if (getEscDecoded_() < currCtx.size()) {
     skipCtxsByEsc_(currCtx);
-    return 2 * ctxInfo_.at(currCtx).cnt.getTotalWordsCnt();
+    return 2 * ctxInfo_.at(currCtx).getTotalWordsCnt();
   }
   if (getEscDecoded_() == currCtx.size()) {
-    return std::max(Count{1}, 2 * zeroCtxCell_.cnt.getTotalWordsCnt());
+    return std::max(Count{1}, 2 * zeroCtxCell_.getTotalWordsCnt());
   }
   assert(getEscDecoded_() == currCtx.size() + 1 &&
          "Esc decode count can not be that big.");
-  return getMaxOrd_() - zeroCtxCell_.uniqueCnt.getTotalWordsCnt();
+  return getMaxOrd_() - zeroCtxCell_.getUniqueTotalWordsCnt();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -136,18 +136,17 @@ auto PPMDDictionary::getDecodeProbabilityStats_(Ord ord) -> ProbabilityStats {
       return getZeroCtxEscStats_();
     }
     if (getEscDecoded_() == currCtx.size()) {
-      if (0 == zeroCtxCell_.cnt.getTotalWordsCnt()) {
+      if (0 == zeroCtxCell_.getTotalWordsCnt()) {
         updateEscDecoded_(ord);
         return {0, 1, 1};
       }
-      const auto zeroLower = zeroCtxCell_.cnt.getLowerCumulativeCnt(ord);
-      const auto zeroLowerUnique =
-          zeroCtxCell_.uniqueCnt.getLowerCumulativeCnt(ord);
-      const auto zeroCnt = zeroCtxCell_.cnt.getCount(ord);
-      const auto zeroUniqueCnt = zeroCtxCell_.uniqueCnt.getCount(ord);
+      const auto zeroLower = zeroCtxCell_.getLowerCumulativeCnt(ord);
+      const auto zeroLowerUnique = zeroCtxCell_.getLowerUniqueCnt(ord);
+      const auto zeroCnt = zeroCtxCell_.getCount(ord);
+      const auto zeroUniqueCnt = zeroCtxCell_.getUniqueCount(ord);
       const auto symLow = 2 * zeroLower - zeroLowerUnique;
       const auto symHigh = symLow + 2 * zeroCnt - zeroUniqueCnt;
-      const auto symTotal = 2 * zeroCtxCell_.cnt.getTotalWordsCnt();
+      const auto symTotal = 2 * zeroCtxCell_.getTotalWordsCnt();
       updateEscDecoded_(ord);
       return {symLow, symHigh, symTotal};
     }
@@ -160,18 +159,18 @@ auto PPMDDictionary::getDecodeProbabilityStats_(Ord ord) -> ProbabilityStats {
   skipCtxsByEsc_(currCtx);
   updateEscDecoded_(ord);
   const auto& currCtxInfo = ctxInfo_.at(currCtx);
-  const auto totalCnt = currCtxInfo.cnt.getTotalWordsCnt();
+  const auto totalCnt = currCtxInfo.getTotalWordsCnt();
   if (isEsc(ord)) {
-    const auto totalUniqueCnt = currCtxInfo.uniqueCnt.getTotalWordsCnt();
+    const auto totalUniqueCnt = currCtxInfo.getUniqueTotalWordsCnt();
     const auto escLow = 2 * totalCnt - totalUniqueCnt;
     const auto escHigh = escLow + totalUniqueCnt;
     const auto escTotal = 2 * totalCnt;
     return {escLow, escHigh, escTotal};
   }
-  const auto lowerCnt = currCtxInfo.cnt.getLowerCumulativeCnt(ord);
-  const auto lowerUniqueCnt = currCtxInfo.uniqueCnt.getLowerCumulativeCnt(ord);
-  const auto cnt = currCtxInfo.cnt.getCount(ord);
-  const auto uniqueCnt = currCtxInfo.uniqueCnt.getCount(ord);
+  const auto lowerCnt = currCtxInfo.getLowerCumulativeCnt(ord);
+  const auto lowerUniqueCnt = currCtxInfo.getLowerUniqueCnt(ord);
+  const auto cnt = currCtxInfo.getCount(ord);
+  const auto uniqueCnt = currCtxInfo.getUniqueCount(ord);
   const auto symLow = 2 * lowerCnt - lowerUniqueCnt;
   const auto symHigh = symLow + 2 * cnt - uniqueCnt;
   const auto symTotal = 2 * totalCnt;
@@ -181,11 +180,9 @@ auto PPMDDictionary::getDecodeProbabilityStats_(Ord ord) -> ProbabilityStats {
 ////////////////////////////////////////////////////////////////////////////////
 auto PPMDDictionary::getDecodeProbabilityStatsForNewWord_(Ord ord) const
     -> ProbabilityStats {
-  const auto symLow =
-      Count{ord} - zeroCtxCell_.uniqueCnt.getLowerCumulativeCnt(ord);
+  const auto symLow = Count{ord} - zeroCtxCell_.getLowerUniqueCnt(ord);
   const auto symHigh = symLow + 1;
-  const auto symTotal =
-      getMaxOrd_() - zeroCtxCell_.uniqueCnt.getTotalWordsCnt();
+  const auto symTotal = getMaxOrd_() - zeroCtxCell_.getUniqueTotalWordsCnt();
   return {symLow, symHigh, symTotal};
 }
 
@@ -193,27 +190,21 @@ auto PPMDDictionary::getDecodeProbabilityStatsForNewWord_(Ord ord) const
 void PPMDDictionary::updateWordCnt_(Ord ord, std::int64_t cntChange) {
   auto currCtx = getInitSearchCtx_();
   for (; !currCtx.empty() && !ctxInfo_.contains(currCtx); currCtx.pop_back()) {
-    auto [iter, insertionHappened] = ctxInfo_.emplace(currCtx, getMaxOrd_());
-    assert(insertionHappened && "Insertion must happen.");
-    iter->second.cnt.increaseOrdCount(ord, cntChange);
-    iter->second.uniqueCnt.update(ord);
+    auto& cell = ctxInfo_.emplace(
+        currCtx, getMaxOrd_(), impl::dict::CountsLayout::sparse,
+        getRescaleThreshold_(), ctxInfo_.getResource());
+    cell.increaseOrdCount(ord, cntChange);
   }
   for (; !currCtx.empty(); currCtx.pop_back()) {
     auto& currCtxInfo = ctxInfo_.at(currCtx);
-    currCtxInfo.cnt.increaseOrdCount(ord, cntChange);
-    currCtxInfo.uniqueCnt.update(ord);
+    currCtxInfo.increaseOrdCount(ord, cntChange);
   }
-  zeroCtxCell_.cnt.increaseOrdCount(ord, cntChange);
-  zeroCtxCell_.uniqueCnt.update(ord);
+  zeroCtxCell_.increaseOrdCount(ord, cntChange);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 auto PPMDDictionary::getWordOrdForNewWord_(Count cumulativeCnt) const -> Ord {
-  const auto getLowerCumulCnt = [this](Ord ord) {
-    return ord + 1 - zeroCtxCell_.uniqueCnt.getLowerCumulativeCnt(ord + 1);
-  };
-  const auto retOrd =
-      *rng::upper_bound(getOrdRng_(), cumulativeCnt, {}, getLowerCumulCnt);
+  const auto retOrd = zeroCtxCell_.getNthUnmetOrd(cumulativeCnt);
   assert(!isEsc(retOrd) &&
          "Search in symbols which were not found yet. Esc is invalid here.");
   return retOrd;
@@ -221,13 +212,13 @@ auto PPMDDictionary::getWordOrdForNewWord_(Count cumulativeCnt) const -> Ord {
 
 ////////////////////////////////////////////////////////////////////////////////
 auto PPMDDictionary::getZeroCtxEscStats_() const -> ProbabilityStats {
-  const auto zeroTotal = zeroCtxCell_.cnt.getTotalWordsCnt();
+  const auto zeroTotal = zeroCtxCell_.getTotalWordsCnt();
   if (0 == zeroTotal) [[unlikely]] {
     return {0, 1, 1};
   }
-  const auto escLow = 2 * zeroTotal - zeroCtxCell_.uniqueCnt.getTotalWordsCnt();
-  const auto escHigh = escLow + zeroCtxCell_.uniqueCnt.getTotalWordsCnt();
-  const auto escTotal = 2 * zeroCtxCell_.cnt.getTotalWordsCnt();
+  const auto escLow = 2 * zeroTotal - zeroCtxCell_.getUniqueTotalWordsCnt();
+  const auto escHigh = escLow + zeroCtxCell_.getUniqueTotalWordsCnt();
+  const auto escTotal = 2 * zeroCtxCell_.getTotalWordsCnt();
   return {escLow, escHigh, escTotal};
 }
 
@@ -0,0 +1,106 @@
+#include <ael/dictionary/normalize_counts.hpp>
+#include <ael/dictionary/static_dictionary.hpp>
+#include <ael/impl/multiply_and_divide.hpp>
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ael::dict {
+
+namespace {
+
+using Ord = std::uint64_t;
+using Count = std::uint64_t;
+
+struct Quantized {
+  Ord ord;
+  Count cnt;
+  Count quantizedCnt;
+};
+
+// Code length decrease of a word, when its quantized count is increased by
+// one.
+double calcIncreaseGain(const Quantized& word) {
+  const auto quantizedCnt = static_cast<double>(word.quantizedCnt);
+  return static_cast<double>(word.cnt) * std::log1p(1.0 / quantizedCnt);
+}
+
+// Code length increase of a word, when its quantized count is decreased by
+// one.
+double calcDecreaseLoss(const Quantized& word) {
+  const auto quantizedCnt = static_cast<double>(word.quantizedCnt);
+  return -static_cast<double>(word.cnt) * std::log1p(-1.0 / quantizedCnt);
+}
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+std::map<Ord, Count> normalizeCounts(const std::map<Ord, Count>& countsMapping,
+                                     std::uint16_t totalLog2) {
+  if (totalLog2 > StaticDictionary::countNumBits) {
+    throw std::invalid_argument("Total is too big for coders.");
+  }
+  const auto newTotal = Count{1} << totalLog2;
+  auto words = std::vector<Quantized>{};
+  auto total = Count{0};
+  for (const auto& [ord, cnt] : countsMapping) {
+    if (cnt != 0) {
+      words.push_back({ord, cnt, 0});
+      total += cnt;
+    }
+  }
+  if (words.empty() || words.size() > newTotal) {
+    throw std::invalid_argument("Counts can not be normalized to the total.");
+  }
+
+  // Rounding down proportional counts leaves less than one count per word.
+  auto quantizedTotal = Count{0};
+  for (auto& word : words) {
+    word.quantizedCnt = std::max(
+        Count{1}, impl::multiply_and_divide(word.cnt, newTotal, total));
+    quantizedTotal += word.quantizedCnt;
+  }
+
+  // Code length is a convex function of each count, so the total is fixed by
+  // unit steps, which change code length the least.
+  using Step = std::pair<double, std::size_t>;
+  if (quantizedTotal < newTotal) {
+    auto steps = std::priority_queue<Step>{};
+    for (std::size_t i = 0; i < words.size(); ++i) {
+      steps.emplace(calcIncreaseGain(words[i]), i);
+    }
+    for (; quantizedTotal < newTotal; ++quantizedTotal) {
+      const auto i = steps.top().second;
+      steps.pop();
+      ++words[i].quantizedCnt;
+      steps.emplace(calcIncreaseGain(words[i]), i);
+    }
+  } else if (quantizedTotal > newTotal) {
+    // Words, which were raised to one, made total too big.
+    auto steps = std::priority_queue<Step>{};
+    for (std::size_t i = 0; i < words.size(); ++i) {
+      if (words[i].quantizedCnt > 1) {
+        steps.emplace(-calcDecreaseLoss(words[i]), i);
+      }
+    }
+    for (; quantizedTotal > newTotal; --quantizedTotal) {
+      const auto i = steps.top().second;
+      steps.pop();
+      --words[i].quantizedCnt;
+      if (words[i].quantizedCnt > 1) {
+        steps.emplace(-calcDecreaseLoss(words[i]), i);
+      }
+    }
+  }
+
+  auto ret = std::map<Ord, Count>{};
+  for (const auto& word : words) {
+    ret.emplace_hint(ret.end(), word.ord, word.quantizedCnt);
+  }
+  return ret;
+}
+
+}  // namespace ael::dict
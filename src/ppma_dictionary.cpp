@@ -1,5 +1,5 @@
 #include <ael/dictionary/ppma_dictionary.hpp>
-#include <ael/impl/dictionary/cumulative_count.hpp>
+#include <ael/impl/dictionary/counts_options.hpp>
 #include <algorithm>
 #include <cstdint>
 #include <ranges>
@@ -11,15 +11,19 @@ namespace rng = std::ranges;
 
 ////////////////////////////////////////////////////////////////////////////////
 PPMADictionary::PPMADictionary(ConstructInfo constructInfo)
-    : Base_(constructInfo.maxOrd, constructInfo.ctxLength),
-      zeroCtxCnt_(constructInfo.maxOrd),
-      zeroCtxUniqueCnt_(constructInfo.maxOrd) {
+    : Base_(constructInfo.maxOrd, constructInfo.ctxLength,
+            constructInfo.rescaleThreshold, constructInfo.maxCtxsCnt,
+            constructInfo.ctxsLimitPolicy),
+      zeroCtxCnt_(constructInfo.maxOrd, impl::dict::CountsLayout::automatic,
+                  constructInfo.rescaleThreshold),
+      ctxInfo_(constructInfo.ctxLength) {
   /**
    * \tau_{ctx}_{i} < sequenceLength
    * Product of tau-s must be less than sequenceLength ^ "tau-s count"
    * Estimation: sequenceLength * l_{ctx} < maxCntBits.
+   * Rescaled context counts are bounded by rescale threshold instead.
    */
-  if (maxSeqLenLog2_ * getCtxLength_() > countNumBits) {
+  if (getCtxTotalCntLog2_(maxSeqLenLog2_) * getCtxLength_() > countNumBits) {
     throw std::logic_error("Too big context.");
   }
 }
@@ -43,6 +47,18 @@ auto PPMADictionary::getProbabilityStats(Ord ord) -> ProbabilityStats {
   return std::move(ret);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+auto PPMADictionary::decodeSymbol(const Count& cumulativeNumFound)
+    -> DecodedWord {
+  const auto getLowerCumulCnt = [this](Ord ord) {
+    return getLowerCumulativeCnt_(ord);
+  };
+  auto ret = impl::dict::findWord(getMaxOrd_(), getTotalWordsCnt(),
+                                  cumulativeNumFound, getLowerCumulCnt);
+  updateWordCnt_(ret.ord, 1);
+  return ret;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 auto PPMADictionary::getTotalWordsCnt() const -> Count {
   Count total = 1;
@@ -51,7 +67,7 @@ auto PPMADictionary::getTotalWordsCnt() const -> Count {
     total *= totalCnt + 1;
   }
   total *= zeroCtxCnt_.getTotalWordsCnt() + 1;
-  if (const auto zeroUniqueCnt = zeroCtxUniqueCnt_.getTotalWordsCnt();
+  if (const auto zeroUniqueCnt = zeroCtxCnt_.getUniqueTotalWordsCnt();
       zeroUniqueCnt < getMaxOrd_()) {
     total *= getMaxOrd_() - zeroUniqueCnt;
   }
@@ -69,10 +85,10 @@ auto PPMADictionary::getLowerCumulativeCnt_(Ord ord) const -> Count {
   }
   lower *= zeroCtxCnt_.getTotalWordsCnt() + 1;
   lower += zeroCtxCnt_.getLowerCumulativeCnt(ord);
-  if (const auto zeroUniqueCnt = zeroCtxUniqueCnt_.getTotalWordsCnt();
+  if (const auto zeroUniqueCnt = zeroCtxCnt_.getUniqueTotalWordsCnt();
       zeroUniqueCnt < getMaxOrd_()) {
     lower *= getMaxOrd_() - zeroUniqueCnt;
-    lower += ord - zeroCtxUniqueCnt_.getLowerCumulativeCnt(ord);
+    lower += ord - zeroCtxCnt_.getLowerUniqueCnt(ord);
   }
   return {lower};
 }
@@ -97,13 +113,13 @@ auto PPMADictionary::getProbabilityStats_(Ord ord) const -> ProbabilityStats {
   lower += zeroCtxCnt_.getLowerCumulativeCnt(ord);
   count *= zeroTotal + 1;
   count += zeroCtxCnt_.getCount(ord);
-  if (const auto zeroUniqueCnt = zeroCtxUniqueCnt_.getTotalWordsCnt();
+  if (const auto zeroUniqueCnt = zeroCtxCnt_.getUniqueTotalWordsCnt();
       zeroUniqueCnt < getMaxOrd_()) {
     total *= getMaxOrd_() - zeroUniqueCnt;
     lower *= getMaxOrd_() - zeroUniqueCnt;
-    lower += ord - zeroCtxUniqueCnt_.getLowerCumulativeCnt(ord);
+    lower += ord - zeroCtxCnt_.getLowerUniqueCnt(ord);
     count *= getMaxOrd_() - zeroUniqueCnt;
-    count += 1 - zeroCtxUniqueCnt_.getCount(ord);
+    count += 1 - zeroCtxCnt_.getUniqueCount(ord);
   }
   assert(count > 0);
   assert(lower + count <= total);
@@ -114,12 +130,12 @@ auto PPMADictionary::getProbabilityStats_(Ord ord) const -> ProbabilityStats {
 void PPMADictionary::updateWordCnt_(Ord ord, std::int64_t cnt) {
   for (auto ctx = getInitSearchCtx_(); !ctx.empty(); ctx.pop_back()) {
     if (!ctxInfo_.contains(ctx)) {
-      ctxInfo_.emplace(ctx, getMaxOrd_());
+      ctxInfo_.emplace(ctx, getMaxOrd_(), impl::dict::CountsLayout::sparse,
+                       getRescaleThreshold_(), ctxInfo_.getResource());
     }
     ctxInfo_.at(ctx).increaseOrdCount(ord, cnt);
   }
   zeroCtxCnt_.increaseOrdCount(ord, cnt);
-  zeroCtxUniqueCnt_.update(ord);
   updateCtx_(ord);
 }
 
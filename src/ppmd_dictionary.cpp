@@ -1,6 +1,5 @@
 #include <ael/dictionary/ppmd_dictionary.hpp>
-#include <ael/impl/dictionary/cumulative_count.hpp>
-#include <ael/impl/dictionary/cumulative_unique_count.hpp>
+#include <ael/impl/dictionary/counts_options.hpp>
 #include <algorithm>
 #include <ranges>
 #include <stdexcept>
@@ -11,14 +10,19 @@ namespace rng = std::ranges;
 
 ////////////////////////////////////////////////////////////////////////////////
 PPMDDictionary::PPMDDictionary(ConstructInfo constructInfo)
-    : Base_(constructInfo.maxOrd, constructInfo.ctxLength),
-      zeroCtxCell_{constructInfo.maxOrd} {
+    : Base_(constructInfo.maxOrd, constructInfo.ctxLength,
+            constructInfo.rescaleThreshold, constructInfo.maxCtxsCnt,
+            constructInfo.ctxsLimitPolicy),
+      zeroCtxCell_{constructInfo.maxOrd, impl::dict::CountsLayout::automatic,
+                   constructInfo.rescaleThreshold},
+      ctxInfo_(constructInfo.ctxLength) {
   /**
    * \tau_{ctx}_{i} < sequenceLength
    * Product of tau-s must be less than sequenceLength ^ "tau-s count"
    * Estimation: sequenceLength * l_{ctx} < maxCntBits.
+   * Rescaled context counts are bounded by rescale threshold instead.
    */
-  if (maxSeqLenLog2_ * getCtxLength_() > countNumBits) {
+  if (getCtxTotalCntLog2_(maxSeqLenLog2_) * getCtxLength_() > countNumBits) {
     throw std::logic_error("Too big context.");
   }
 }
@@ -39,18 +43,30 @@ auto PPMDDictionary::getProbabilityStats(Ord ord) -> ProbabilityStats {
   return ret;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+auto PPMDDictionary::decodeSymbol(const Count& cumulativeNumFound)
+    -> DecodedWord {
+  const auto getLowerCumulCnt = [this](Ord ord) {
+    return getLowerCumulativeCnt_(ord);
+  };
+  auto ret = impl::dict::findWord(getMaxOrd_(), getTotalWordsCnt(),
+                                  cumulativeNumFound, getLowerCumulCnt);
+  updateWordCnt_(ret.ord, 1);
+  return ret;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 auto PPMDDictionary::getTotalWordsCnt() const -> Count {
   Count total = 1;
   for (auto ctx = getSearchCtxEmptySkipped_(); !ctx.empty(); ctx.pop_back()) {
-    const auto totalCnt = ctxInfo_.at(ctx).cnt.getTotalWordsCnt();
+    const auto totalCnt = ctxInfo_.at(ctx).getTotalWordsCnt();
     total *= totalCnt * 2;
   }
-  if (const auto totalZeroCtxCnt = zeroCtxCell_.cnt.getTotalWordsCnt();
+  if (const auto totalZeroCtxCnt = zeroCtxCell_.getTotalWordsCnt();
       totalZeroCtxCnt != 0) {
     total *= totalZeroCtxCnt * 2;
   }
-  if (const auto zeroUniqueCnt = zeroCtxCell_.uniqueCnt.getTotalWordsCnt();
+  if (const auto zeroUniqueCnt = zeroCtxCell_.getUniqueTotalWordsCnt();
       zeroUniqueCnt < getMaxOrd_()) {
     total *= getMaxOrd_() - zeroUniqueCnt;
   }
@@ -64,27 +80,25 @@ auto PPMDDictionary::getLowerCumulativeCnt_(Ord ord) const -> Count {
   Count uniqueCountsProd = 1;
   for (auto ctx = getSearchCtxEmptySkipped_(); !ctx.empty(); ctx.pop_back()) {
     const auto& ctxCell = ctxInfo_.at(ctx);
-    const auto ctxTotalCnt = ctxCell.cnt.getTotalWordsCnt();
+    const auto ctxTotalCnt = ctxCell.getTotalWordsCnt();
     lower *= ctxTotalCnt * 2;
-    const auto lowerCnt = ctxCell.cnt.getLowerCumulativeCnt(ord);
-    const auto lowerUniqueCnt = ctxCell.uniqueCnt.getLowerCumulativeCnt(ord);
+    const auto lowerCnt = ctxCell.getLowerCumulativeCnt(ord);
+    const auto lowerUniqueCnt = ctxCell.getLowerUniqueCnt(ord);
     lower += (lowerCnt * 2 - lowerUniqueCnt) * uniqueCountsProd;
-    uniqueCountsProd *= ctxCell.uniqueCnt.getTotalWordsCnt();
+    uniqueCountsProd *= ctxCell.getUniqueTotalWordsCnt();
   }
-  const auto zeroCtxTotalUniqueCnt = zeroCtxCell_.uniqueCnt.getTotalWordsCnt();
-  if (const auto zeroCtxTotalCnt = zeroCtxCell_.cnt.getTotalWordsCnt();
+  const auto zeroCtxTotalUniqueCnt = zeroCtxCell_.getUniqueTotalWordsCnt();
+  if (const auto zeroCtxTotalCnt = zeroCtxCell_.getTotalWordsCnt();
       zeroCtxTotalCnt != 0) {
     lower *= zeroCtxTotalCnt * 2;
-    const auto cumulativeCnt = zeroCtxCell_.cnt.getLowerCumulativeCnt(ord);
-    const auto cumulativeUniqueCnt =
-        zeroCtxCell_.uniqueCnt.getLowerCumulativeCnt(ord);
+    const auto cumulativeCnt = zeroCtxCell_.getLowerCumulativeCnt(ord);
+    const auto cumulativeUniqueCnt = zeroCtxCell_.getLowerUniqueCnt(ord);
     lower += (cumulativeCnt * 2 - cumulativeUniqueCnt) * uniqueCountsProd;
     uniqueCountsProd *= zeroCtxTotalUniqueCnt;
   }
   if (zeroCtxTotalUniqueCnt < getMaxOrd_()) {
     lower *= getMaxOrd_() - zeroCtxTotalUniqueCnt;
-    lower += (ord - zeroCtxCell_.uniqueCnt.getLowerCumulativeCnt(ord)) *
-             uniqueCountsProd;
+    lower += (ord - zeroCtxCell_.getLowerUniqueCnt(ord)) * uniqueCountsProd;
   }
   return {lower};
 }
@@ -97,29 +111,28 @@ auto PPMDDictionary::getProbabilityStats_(Ord ord) const -> ProbabilityStats {
   Count total = 1;
   Count uniqueCountsProd = 1;
   for (auto ctx = getSearchCtxEmptySkipped_(); !ctx.empty(); ctx.pop_back()) {
-    const auto& ctxInfo = ctxInfo_.at(ctx).cnt;
-    const auto& ctxUniqueInfo = ctxInfo_.at(ctx).uniqueCnt;
+    const auto& ctxInfo = ctxInfo_.at(ctx);
     const auto ctxTotalCnt = ctxInfo.getTotalWordsCnt();
     lower *= ctxTotalCnt * 2;
     const auto lowerCnt = ctxInfo.getLowerCumulativeCnt(ord);
-    const auto lowerUniqueCnt = ctxUniqueInfo.getLowerCumulativeCnt(ord);
+    const auto lowerUniqueCnt = ctxInfo.getLowerUniqueCnt(ord);
     lower += (lowerCnt * 2 - lowerUniqueCnt) * uniqueCountsProd;
     total *= ctxTotalCnt * 2;
     count *= ctxTotalCnt * 2;
     const auto cnt = ctxInfo.getCount(ord);
-    const auto uniqueCnt = ctxUniqueInfo.getCount(ord);
+    const auto uniqueCnt = ctxInfo.getUniqueCount(ord);
     count += (cnt * 2 - uniqueCnt) * uniqueCountsProd;
-    uniqueCountsProd *= ctxUniqueInfo.getTotalWordsCnt();
+    uniqueCountsProd *= ctxInfo.getUniqueTotalWordsCnt();
   }
-  const auto zeroCtxUniqueTotal = zeroCtxCell_.uniqueCnt.getTotalWordsCnt();
-  const auto zeroCtxTotal = zeroCtxCell_.cnt.getTotalWordsCnt();
+  const auto zeroCtxUniqueTotal = zeroCtxCell_.getUniqueTotalWordsCnt();
+  const auto zeroCtxTotal = zeroCtxCell_.getTotalWordsCnt();
   lower *= zeroCtxTotal * 2;
-  const auto lowerCnt = zeroCtxCell_.cnt.getLowerCumulativeCnt(ord);
-  const auto lowerUniqueCnt = zeroCtxCell_.uniqueCnt.getLowerCumulativeCnt(ord);
+  const auto lowerCnt = zeroCtxCell_.getLowerCumulativeCnt(ord);
+  const auto lowerUniqueCnt = zeroCtxCell_.getLowerUniqueCnt(ord);
   lower += (lowerCnt * 2 - lowerUniqueCnt) * uniqueCountsProd;
   count *= zeroCtxTotal * 2;
-  const auto cnt = zeroCtxCell_.cnt.getCount(ord);
-  const auto uniqueCnt = zeroCtxCell_.uniqueCnt.getCount(ord);
+  const auto cnt = zeroCtxCell_.getCount(ord);
+  const auto uniqueCnt = zeroCtxCell_.getUniqueCount(ord);
   count += (cnt * 2 - uniqueCnt) * uniqueCountsProd;
   if (zeroCtxTotal != 0) {
     total *= zeroCtxTotal * 2;
@@ -128,10 +141,9 @@ auto PPMDDictionary::getProbabilityStats_(Ord ord) const -> ProbabilityStats {
   if (zeroCtxUniqueTotal < getMaxOrd_()) {
     total *= getMaxOrd_() - zeroCtxUniqueTotal;
     lower *= getMaxOrd_() - zeroCtxUniqueTotal;
-    lower += (ord - zeroCtxCell_.uniqueCnt.getLowerCumulativeCnt(ord)) *
-             uniqueCountsProd;
+    lower += (ord - zeroCtxCell_.getLowerUniqueCnt(ord)) * uniqueCountsProd;
     count *= getMaxOrd_() - zeroCtxUniqueTotal;
-    count += uniqueCountsProd * (1 - zeroCtxCell_.uniqueCnt.getCount(ord));
+    count += uniqueCountsProd * (1 - zeroCtxCell_.getUniqueCount(ord));
   }
   assert(count > 0);
   assert(lower + count <= total);
@@ -142,13 +154,12 @@ auto PPMDDictionary::getProbabilityStats_(Ord ord) const -> ProbabilityStats {
 void PPMDDictionary::updateWordCnt_(Ord ord, std::int64_t cnt) {
   for (auto ctx = getInitSearchCtx_(); !ctx.empty(); ctx.pop_back()) {
     if (!ctxInfo_.contains(ctx)) {
-      ctxInfo_.emplace(ctx, CtxCell_(getMaxOrd_()));
+      ctxInfo_.emplace(ctx, getMaxOrd_(), impl::dict::CountsLayout::sparse,
+                       getRescaleThreshold_(), ctxInfo_.getResource());
     }
-    ctxInfo_.at(ctx).cnt.increaseOrdCount(ord, cnt);
-    ctxInfo_.at(ctx).uniqueCnt.update(ord);
+    ctxInfo_.at(ctx).increaseOrdCount(ord, cnt);
   }
-  zeroCtxCell_.cnt.increaseOrdCount(ord, cnt);
-  zeroCtxCell_.uniqueCnt.update(ord);
+  zeroCtxCell_.increaseOrdCount(ord, cnt);
   updateCtx_(ord);
 }
 
@@ -0,0 +1,51 @@
+#include <ael/range_coder.hpp>
+
+namespace ael {
+
+////////////////////////////////////////////////////////////////////////////////
+auto RangeCoder::getStatsChange() -> Stats {
+  auto ret = Stats{wordsCnt_ - prevWordsCnt_,
+                   (bytesEncoded_ - prevBytesEncoded_) * CHAR_BIT};
+  prevWordsCnt_ = wordsCnt_;
+  prevBytesEncoded_ = bytesEncoded_;
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto RangeCoder::finalize() && -> FinalRet {
+  using WideNum = impl::RangeCoderState::WideNum;
+  const auto numBits = state_.numBits;
+  const auto high = WideNum{state_.low + state_.range};
+  // Take a value with most trailing zeros, such that any following bits keep
+  // it inside the interval. Only bits before trailing zeros are written.
+  auto low = state_.low;
+  auto zeros = numBits;
+  for (;; --zeros) {
+    const auto mask = (WideNum{1} << zeros) - 1;
+    if (const auto value = WideNum{(low + mask) & ~mask}; value + mask < high) {
+      low = value;
+      break;
+    }
+  }
+  for (auto written = zeros; written < numBits; written += CHAR_BIT) {
+    shiftLow_(low, numBits);
+  }
+  putPendingBytes_((low >> numBits) != 0);
+
+  return {std::move(dataConstructor_), wordsCnt_, bytesEncoded_ * CHAR_BIT};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void RangeCoder::putPendingBytes_(bool carry) {
+  if (pendingBytes_ == 0) {
+    return;
+  }
+  dataConstructor_->putByte(
+      static_cast<std::byte>(cache_ + static_cast<std::uint8_t>(carry)));
+  // Pending 0xFF bytes turn into zeros on carry.
+  dataConstructor_->putBitsRepeat(!carry, (pendingBytes_ - 1) * CHAR_BIT);
+  bytesEncoded_ += pendingBytes_;
+  pendingBytes_ = 0;
+}
+
+}  // namespace ael
@@ -0,0 +1,127 @@
+#include <ael/dictionary/sorted_adaptive_a_dictionary.hpp>
+#include <cassert>
+#include <utility>
+
+namespace ael::dict {
+
+////////////////////////////////////////////////////////////////////////////////
+SortedAdaptiveADictionary::SortedAdaptiveADictionary(Ord maxOrd,
+                                                     Count rescaleThreshold)
+    : MaxOrdBase(maxOrd),
+      entries_(maxOrd),
+      positions_(maxOrd),
+      rescaleThreshold_{rescaleThreshold} {
+  for (auto ord : getOrdRng_()) {
+    entries_[ord] = {ord, 0};
+    positions_[ord] = ord;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto SortedAdaptiveADictionary::getProbabilityStats(Ord ord)
+    -> ProbabilityStats {
+  const auto pos = positions_[ord];
+  const auto low = getLowerCumulativeCnt_(pos);
+  const auto ret = ProbabilityStats{low, low + getWordCnt_(entries_[pos].cnt),
+                                    getTotalWordsCnt()};
+  updateWordCnt_(pos);
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto SortedAdaptiveADictionary::decodeSymbol(Count cumulativeCnt)
+    -> DecodedWord {
+  const auto [pos, low] = findPos_(cumulativeCnt);
+  const auto ret =
+      DecodedWord{entries_[pos].ord, low, low + getWordCnt_(entries_[pos].cnt),
+                  getTotalWordsCnt()};
+  updateWordCnt_(pos);
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto SortedAdaptiveADictionary::getTotalWordsCnt() const -> Count {
+  if (getUnmetCnt_() == 0) {
+    return wordsCnt_;
+  }
+  return getUnmetCnt_() * (wordsCnt_ + 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto SortedAdaptiveADictionary::getWordCnt_(Count realCnt) const -> Count {
+  if (getUnmetCnt_() == 0) {
+    return realCnt;
+  }
+  return realCnt == 0 ? 1 : realCnt * getUnmetCnt_();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto SortedAdaptiveADictionary::getLowerCumulativeCnt_(std::size_t pos) const
+    -> Count {
+  if (pos >= uniqueWordsCnt_) {
+    // Met words take `unmet * wordsCnt`, and every word, which was not met,
+    // takes one.
+    return getUnmetCnt_() * wordsCnt_ + (pos - uniqueWordsCnt_);
+  }
+  auto realLowerCnt = Count{0};
+  for (std::size_t i = 0; i < pos; ++i) {
+    realLowerCnt += entries_[i].cnt;
+  }
+  return getUnmetCnt_() == 0 ? realLowerCnt : realLowerCnt * getUnmetCnt_();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto SortedAdaptiveADictionary::findPos_(Count cumulativeCnt) const
+    -> FoundPos_ {
+  assert(cumulativeCnt < getTotalWordsCnt());
+  const auto scale = getUnmetCnt_() == 0 ? Count{1} : getUnmetCnt_();
+  if (const auto metCnt = wordsCnt_ * scale; cumulativeCnt >= metCnt) {
+    const auto pos = uniqueWordsCnt_ + (cumulativeCnt - metCnt);
+    return {static_cast<std::size_t>(pos), cumulativeCnt};
+  }
+  // Scale is the same for all met words, so real counts are compared.
+  const auto realTarget = cumulativeCnt / scale;
+  auto realLowerCnt = Count{0};
+  auto pos = std::size_t{0};
+  for (; realLowerCnt + entries_[pos].cnt <= realTarget; ++pos) {
+    realLowerCnt += entries_[pos].cnt;
+  }
+  return {pos, realLowerCnt * scale};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void SortedAdaptiveADictionary::updateWordCnt_(std::size_t pos) {
+  if (entries_[pos].cnt == 0) {
+    // First word, which was not met, takes place of this one, so that met
+    // words stay before not met ones.
+    std::swap(entries_[pos], entries_[uniqueWordsCnt_]);
+    positions_[entries_[pos].ord] = pos;
+    pos = uniqueWordsCnt_;
+    ++uniqueWordsCnt_;
+  }
+  ++entries_[pos].cnt;
+  ++wordsCnt_;
+  // Counts grow by one, so a word moves past a run of words with a count,
+  // which is one less, and the order stays sorted.
+  const auto cnt = entries_[pos].cnt;
+  auto newPos = pos;
+  for (; newPos != 0 && entries_[newPos - 1].cnt < cnt; --newPos) {
+    // Skip all words with smaller counts.
+  }
+  if (newPos != pos) {
+    std::swap(entries_[pos], entries_[newPos]);
+    positions_[entries_[pos].ord] = pos;
+  }
+  positions_[entries_[newPos].ord] = newPos;
+
+  if (wordsCnt_ > rescaleThreshold_) {
+    // Halving rounding up keeps the order and keeps met words met.
+    wordsCnt_ = 0;
+    for (std::size_t i = 0; i < uniqueWordsCnt_; ++i) {
+      entries_[i].cnt -= entries_[i].cnt / 2;
+      wordsCnt_ += entries_[i].cnt;
+    }
+  }
+}
+
+}  // namespace ael::dict
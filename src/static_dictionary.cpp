@@ -1,5 +1,7 @@
 #include <ael/dictionary/static_dictionary.hpp>
 #include <algorithm>
+#include <bit>
+#include <limits>
 
 namespace ael::dict {
 
@@ -18,12 +20,20 @@ StaticDictionary::StaticDictionary(Ord maxOrd,
   for (; currOrd < maxOrd; ++currOrd) {
     cumulativeNumFound_[currOrd] = currCumulativeNumFound;
   }
+  if (std::has_single_bit(currCumulativeNumFound)) {
+    totalWordsCntLog2_ = std::countr_zero(currCumulativeNumFound);
+  }
+  if (totalWordsCntLog2_ <= lookupTableMaxLog2 &&
+      maxOrd <= std::numeric_limits<std::uint32_t>::max()) {
+    buildLookupTable_();
+  } else if (maxOrd >= decodeIndexMinOrd && currCumulativeNumFound != 0) {
+    buildDecodeIndex_();
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 auto StaticDictionary::getWordOrd(Count cumulativeNumFound) const -> Ord {
-  return std::ranges::upper_bound(cumulativeNumFound_, cumulativeNumFound) -
-         cumulativeNumFound_.begin();
+  return findWord_(cumulativeNumFound);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -33,9 +43,67 @@ auto StaticDictionary::getProbabilityStats(Ord ord) -> ProbabilityStats {
   return {low, high, *cumulativeNumFound_.rbegin()};
 }
 
+////////////////////////////////////////////////////////////////////////////////
+auto StaticDictionary::decodeSymbol(Count cumulativeNumFound) const
+    -> DecodedWord {
+  const auto ord = findWord_(cumulativeNumFound);
+  return {ord, getLowerCumulativeCnt_(ord), getHigherCumulativeCnt_(ord),
+          getTotalWordsCnt()};
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 auto StaticDictionary::getLowerCumulativeCnt_(Ord ord) const -> Count {
   return ord != 0 ? cumulativeNumFound_[ord - 1] : 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+void StaticDictionary::buildDecodeIndex_() {
+  // About one bucket per word, but not more buckets than counts.
+  const auto maxOrd = cumulativeNumFound_.size();
+  const auto totalBits = std::bit_width(getTotalWordsCnt() - 1);
+  const auto bucketBits = std::bit_width(maxOrd);
+  bucketShift_ = static_cast<std::uint16_t>(
+      totalBits > bucketBits ? totalBits - bucketBits : 0);
+  const auto bucketsCnt = ((getTotalWordsCnt() - 1) >> bucketShift_) + 2;
+  bucketWords_.resize(bucketsCnt);
+  auto ord = Ord{0};
+  for (std::size_t bucket = 0; bucket < bucketsCnt; ++bucket) {
+    const auto bucketStart = Count{bucket} << bucketShift_;
+    for (; ord < maxOrd && cumulativeNumFound_[ord] <= bucketStart; ++ord) {
+      // Skip words, which end before the bucket.
+    }
+    bucketWords_[bucket] = ord;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void StaticDictionary::buildLookupTable_() {
+  lookupTable_.reserve(getTotalWordsCnt());
+  auto lower = Count{0};
+  for (std::size_t ord = 0; ord < cumulativeNumFound_.size(); ++ord) {
+    lookupTable_.insert(lookupTable_.end(), cumulativeNumFound_[ord] - lower,
+                        static_cast<std::uint32_t>(ord));
+    lower = cumulativeNumFound_[ord];
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+auto StaticDictionary::findWord_(Count cumulativeNumFound) const -> Ord {
+  if (!lookupTable_.empty()) {
+    return lookupTable_[cumulativeNumFound];
+  }
+  if (bucketWords_.empty()) {
+    return std::ranges::upper_bound(cumulativeNumFound_, cumulativeNumFound) -
+           cumulativeNumFound_.begin();
+  }
+  // The word is between first words of this bucket and of the next one.
+  const auto bucket = cumulativeNumFound >> bucketShift_;
+  const auto first = cumulativeNumFound_.begin() + bucketWords_[bucket];
+  const auto last =
+      cumulativeNumFound_.begin() +
+      std::min(bucketWords_[bucket + 1] + 1, cumulativeNumFound_.size());
+  return std::upper_bound(first, last, cumulativeNumFound) -
+         cumulativeNumFound_.begin();
+}
+
 }  // namespace ael::dict
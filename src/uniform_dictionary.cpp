@@ -1,7 +1,16 @@
 #include <ael/dictionary/uniform_dictionary.hpp>
+#include <bit>
 
 namespace ael::dict {
 
+////////////////////////////////////////////////////////////////////////////////
+UniformDictionary::UniformDictionary(Ord maxOrd)
+    : maxOrd_(maxOrd),
+      totalWordsCntLog2_(std::has_single_bit(maxOrd)
+                             ? std::countr_zero(maxOrd)
+                             : impl::dict::unknownTotalWordsCntLog2) {
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 auto UniformDictionary::getWordOrd(Count cumulativeNumFound) const -> Ord {
   return cumulativeNumFound;
@@ -49,6 +49,67 @@ TEST(ByteDataConstructor, PutBits2) {
   EXPECT_EQ(encoded.data()[1], std::byte{0b10000000});
 }
 
+TEST(ByteDataConstructor, PutBitsWord) {
+  auto encoded = ByteDataConstructor();
+  encoded.putBits(0b1011, 4);
+  encoded.putBits(0b110011001, 9);
+  EXPECT_EQ(encoded.size(), 2);
+  EXPECT_EQ(encoded.data()[0], std::byte{0b10111100});
+  EXPECT_EQ(encoded.data()[1], std::byte{0b11001000});
+}
+
+TEST(ByteDataConstructor, PutBitsIgnoresHighBits) {
+  auto encoded = ByteDataConstructor();
+  encoded.putBits(0b11110101, 3);
+  EXPECT_EQ(encoded.size(), 1);
+  EXPECT_EQ(encoded.data()[0], std::byte{0b10100000});
+}
+
+TEST(ByteDataConstructor, PutBits64Unaligned) {
+  auto encoded = ByteDataConstructor();
+  encoded.putBit(true);
+  encoded.putBits(0x8000000000000001, 64);
+  EXPECT_EQ(encoded.size(), 9);
+  EXPECT_EQ(encoded.data()[0], std::byte{0b11000000});
+  for (std::size_t i = 1; i < 8; ++i) {
+    EXPECT_EQ(encoded.data()[i], std::byte{0b00000000});
+  }
+  EXPECT_EQ(encoded.data()[8], std::byte{0b10000000});
+}
+
+TEST(ByteDataConstructor, PutBitsRepeatLong) {
+  auto encoded = ByteDataConstructor();
+  encoded.putBit(false);
+  encoded.putBitsRepeat(true, 20);
+  EXPECT_EQ(encoded.size(), 3);
+  EXPECT_EQ(encoded.data()[0], std::byte{0b01111111});
+  EXPECT_EQ(encoded.data()[1], std::byte{0b11111111});
+  EXPECT_EQ(encoded.data()[2], std::byte{0b11111000});
+}
+
+TEST(ByteDataConstructor, PutBitThenRepeatOpposite) {
+  auto encoded = ByteDataConstructor();
+  auto num = std::size_t{3};
+  encoded.putBitThenRepeatOppositeWithReset(true, num);
+  EXPECT_EQ(num, 0);
+  num = 70;
+  encoded.putBitThenRepeatOppositeWithReset(false, num);
+  EXPECT_EQ(num, 0);
+  EXPECT_EQ(encoded.size(), 10);
+  EXPECT_EQ(encoded.data()[0], std::byte{0b10000111});
+  EXPECT_EQ(encoded.data()[8], std::byte{0b11111111});
+  EXPECT_EQ(encoded.data()[9], std::byte{0b11100000});
+}
+
+TEST(ByteDataConstructor, PutByteAfterBits) {
+  auto encoded = ByteDataConstructor();
+  encoded.putBits(0b101, 3);
+  encoded.putByte(std::byte{0b11001100});
+  EXPECT_EQ(encoded.size(), 2);
+  EXPECT_EQ(encoded.data()[0], std::byte{0b10111001});
+  EXPECT_EQ(encoded.data()[1], std::byte{0b10000000});
+}
+
 TEST(ByteDataConstructor, PutByte) {
   auto encoded = ByteDataConstructor();
   encoded.putByte(std::byte{42});
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <ael/impl/dictionary/compact_cumulative_count.hpp>
+#include <cstdint>
+#include <memory_resource>
+#include <random>
+#include <ranges>
+#include <vector>
+
+using ael::impl::dict::CompactCumulativeCount;
+using ael::impl::dict::CountsLayout;
+
+// NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
+
+namespace {
+
+void checkCounts(const CompactCumulativeCount& cnts,
+                 const std::vector<std::uint64_t>& realCnts) {
+  auto realLower = std::uint64_t{0};
+  auto uniqueLower = std::uint64_t{0};
+  for (auto ord : std::ranges::iota_view(std::uint64_t{0}, realCnts.size())) {
+    EXPECT_EQ(cnts.getLowerCumulativeCnt(ord), realLower);
+    EXPECT_EQ(cnts.getLowerUniqueCnt(ord), uniqueLower);
+    EXPECT_EQ(cnts.getCount(ord), realCnts[ord]);
+    EXPECT_EQ(cnts.getUniqueCount(ord), realCnts[ord] != 0 ? 1 : 0);
+    realLower += realCnts[ord];
+    uniqueLower += realCnts[ord] != 0 ? 1 : 0;
+  }
+  EXPECT_EQ(cnts.getTotalWordsCnt(), realLower);
+  EXPECT_EQ(cnts.getUniqueTotalWordsCnt(), uniqueLower);
+}
+
+}  // namespace
+
+TEST(CompactCumulativeCount, InlineUntilFifthWord) {
+  auto cnts = CompactCumulativeCount(16, CountsLayout::sparse);
+  auto realCnts = std::vector<std::uint64_t>(16, 0);
+  for (const auto ord : {7, 3, 7, 12, 0, 3}) {
+    cnts.increaseOrdCount(ord, 1);
+    ++realCnts[ord];
+    EXPECT_TRUE(cnts.isInline());
+    checkCounts(cnts, realCnts);
+  }
+  cnts.increaseOrdCount(9, 2);
+  realCnts[9] += 2;
+  EXPECT_FALSE(cnts.isInline());
+  checkCounts(cnts, realCnts);
+}
+
+TEST(CompactCumulativeCount, FuzzAgainstPrefixSums) {
+  constexpr auto maxOrd = std::uint64_t{37};
+  for (const auto wordsCnt : {std::uint64_t{3}, maxOrd}) {
+    auto gen = std::mt19937(42);
+    auto cnts = CompactCumulativeCount(maxOrd, CountsLayout::sparse, 200);
+    auto realCnts = std::vector<std::uint64_t>(maxOrd, 0);
+    auto total = std::uint64_t{0};
+    for ([[maybe_unused]] auto i : std::ranges::iota_view(0, 500)) {
+      const auto ord = gen() % wordsCnt * (maxOrd / wordsCnt);
+      const auto cnt = gen() % 3 + 1;
+      cnts.increaseOrdCount(ord, static_cast<std::int64_t>(cnt));
+      realCnts[ord] += cnt;
+      total += cnt;
+      if (total > 200) {
+        total = 0;
+        for (auto& realCnt : realCnts) {
+          realCnt -= realCnt / 2;
+          total += realCnt;
+        }
+      }
+    }
+    EXPECT_EQ(cnts.isInline(), wordsCnt <= 4);
+    checkCounts(cnts, realCnts);
+  }
+}
+
+TEST(CompactCumulativeCount, NthUnmetOrd) {
+  auto cnts = CompactCumulativeCount(10);
+  for (const auto ord : {1, 2, 6}) {
+    cnts.increaseOrdCount(ord, 1);
+  }
+  const auto unmet = std::vector<std::uint64_t>{0, 3, 4, 5, 7, 8, 9};
+  for (auto num : std::ranges::iota_view(std::size_t{0}, unmet.size())) {
+    EXPECT_EQ(cnts.getNthUnmetOrd(num), unmet[num]);
+  }
+  for (const auto ord : {0, 8, 9}) {
+    cnts.increaseOrdCount(ord, 1);
+  }
+  ASSERT_FALSE(cnts.isInline());
+  EXPECT_EQ(cnts.getNthUnmetOrd(0), 3);
+  EXPECT_EQ(cnts.getNthUnmetOrd(3), 7);
+}
+
+TEST(CompactCumulativeCount, MoveKeepsCounts) {
+  auto resource = std::pmr::unsynchronized_pool_resource();
+  auto cnts = CompactCumulativeCount(8, CountsLayout::sparse,
+                                     ael::impl::dict::noRescale, &resource);
+  for (auto ord : std::ranges::iota_view(std::uint64_t{0}, std::uint64_t{6})) {
+    cnts.increaseOrdCount(ord, static_cast<std::int64_t>(ord + 1));
+  }
+  const auto moved = std::move(cnts);
+  EXPECT_FALSE(moved.isInline());
+  EXPECT_EQ(moved.getTotalWordsCnt(), 21);
+  EXPECT_EQ(moved.getLowerCumulativeCnt(3), 6);
+  EXPECT_EQ(moved.getUniqueTotalWordsCnt(), 6);
+}
+
+// NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
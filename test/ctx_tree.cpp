@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <ael/impl/dictionary/ctx_tree.hpp>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
+
+namespace {
+
+using ael::impl::dict::CtxLinks;
+using ael::impl::dict::CtxTree;
+
+TEST(CtxTree, EmptyCtx) {
+  auto tree = CtxTree<int>(3);
+  const auto ctx = tree.getCurrCtx();
+  EXPECT_TRUE(ctx.empty());
+  EXPECT_EQ(ctx.size(), 0);
+  EXPECT_FALSE(tree.contains(ctx));
+}
+
+TEST(CtxTree, ZeroLengthStaysEmpty) {
+  auto tree = CtxTree<int>(0);
+  tree.update(1);
+  tree.update(2);
+  EXPECT_TRUE(tree.getCurrCtx().empty());
+  EXPECT_EQ(tree.getNodesCnt(), 1);
+}
+
+TEST(CtxTree, LengthIsBounded) {
+  auto tree = CtxTree<int>(3);
+  for (std::uint64_t i = 0; i < 10; ++i) {
+    tree.update(i);
+    EXPECT_EQ(tree.getCurrCtx().size(), std::min<std::uint64_t>(i + 1, 3));
+  }
+}
+
+TEST(CtxTree, SuffixLinksDropOldestWord) {
+  auto tree = CtxTree<int>(3);
+  tree.update(1);
+  tree.update(2);
+  tree.update(3);
+  const auto ctx123 = tree.getCurrNode();
+  auto other = CtxTree<int>(3);
+  other.update(3);
+  const auto ctx3 = other.getCurrNode();
+  other.update(7);
+  other.update(2);
+  other.update(3);
+  EXPECT_EQ(tree.getLength(tree.getSuffix(ctx123)), 2);
+  EXPECT_EQ(tree.getLength(tree.getSuffix(tree.getSuffix(ctx123))), 1);
+  EXPECT_EQ(tree.getSuffix(tree.getSuffix(tree.getSuffix(ctx123))),
+            CtxLinks::root);
+  // Context {3} is the shortest suffix of {2, 3} in both trees.
+  EXPECT_EQ(other.getSuffix(other.getSuffix(other.getCurrNode())), ctx3);
+}
+
+TEST(CtxTree, SameWordsGiveSameNode) {
+  auto tree = CtxTree<int>(2);
+  tree.update(1);
+  tree.update(2);
+  const auto ctx12 = tree.getCurrNode();
+  const auto nodesCnt = tree.getNodesCnt();
+  tree.update(5);
+  tree.update(1);
+  tree.update(2);
+  EXPECT_EQ(tree.getCurrNode(), ctx12);
+  // Only {5}, {2, 5}, {5, 1} are new.
+  EXPECT_EQ(tree.getNodesCnt(), nodesCnt + 3);
+}
+
+TEST(CtxTree, Cells) {
+  auto tree = CtxTree<int>(2);
+  tree.update(1);
+  auto ctx = tree.getCurrCtx();
+  EXPECT_FALSE(tree.contains(ctx));
+  tree.emplace(ctx, 42);
+  EXPECT_TRUE(tree.contains(ctx));
+  tree.update(2);
+  tree.update(1);
+  EXPECT_FALSE(tree.contains(tree.getCurrCtx()));
+  auto shortCtx = tree.getCurrCtx();
+  shortCtx.resize(1);
+  ASSERT_TRUE(tree.contains(shortCtx));
+  EXPECT_EQ(tree.at(shortCtx), 42);
+  tree.at(shortCtx) = 37;
+  EXPECT_EQ(tree.at(ctx), 37);
+}
+
+TEST(CtxTree, Reset) {
+  auto tree = CtxTree<int>(2);
+  tree.update(1);
+  tree.emplace(tree.getCurrCtx(), 42);
+  tree.update(2);
+  tree.reset();
+  EXPECT_TRUE(tree.getCurrCtx().empty());
+  EXPECT_EQ(tree.getNodesCnt(), 1);
+  tree.update(1);
+  EXPECT_EQ(tree.getCurrCtx().size(), 1);
+  EXPECT_FALSE(tree.contains(tree.getCurrCtx()));
+}
+
+TEST(CtxTree, FreezeKeepsNodes) {
+  auto tree = CtxTree<int>(2);
+  tree.update(1);
+  tree.update(2);
+  const auto ctx2 = tree.getSuffix(tree.getCurrNode());
+  const auto nodesCnt = tree.getNodesCnt();
+  tree.freeze();
+  tree.update(3);
+  EXPECT_TRUE(tree.getCurrCtx().empty());
+  tree.update(2);
+  EXPECT_EQ(tree.getCurrNode(), ctx2);
+  tree.update(1);
+  tree.update(2);
+  EXPECT_EQ(tree.getCurrCtx().size(), 2);
+  EXPECT_EQ(tree.getNodesCnt(), nodesCnt);
+}
+
+TEST(CtxTree, PruneRemovesRareContexts) {
+  auto tree = CtxTree<int>(3);
+  for (std::size_t i = 0; i < 20; ++i) {
+    tree.update(1);
+  }
+  tree.update(2);
+  tree.update(1);
+  auto ctx = tree.getCurrCtx();
+  tree.emplace(ctx, 42);
+  ctx.pop_back();
+  tree.emplace(ctx, 37);
+  // {}, {1}, {1, 1}, {1, 1, 1}, {2}, {1, 2}, {1, 1, 2}, {2, 1}, {1, 2, 1}.
+  ASSERT_EQ(tree.getNodesCnt(), 9);
+  tree.prune(4);
+  EXPECT_EQ(tree.getNodesCnt(), 4);
+  // Frequent {1}, {1, 1}, {1, 1, 1} are left, current {1, 2, 1} and {2, 1}
+  // are not.
+  EXPECT_EQ(tree.getCurrCtx().size(), 1);
+  EXPECT_FALSE(tree.contains(tree.getCurrCtx()));
+  tree.update(1);
+  tree.update(1);
+  EXPECT_EQ(tree.getCurrCtx().size(), 3);
+}
+
+TEST(CtxTree, PruneKeepsCells) {
+  auto tree = CtxTree<int>(2);
+  auto gen = std::mt19937{42};
+  auto distr = std::uniform_int_distribution<std::uint64_t>(0, 7);
+  auto cellsCnt = 0;
+  for (std::size_t i = 0; i < 300; ++i) {
+    tree.update(distr(gen) % (i % 2 == 0 ? 8 : 2));
+    if (const auto ctx = tree.getCurrCtx(); !tree.contains(ctx)) {
+      tree.emplace(ctx, static_cast<int>(ctx.size()));
+      ++cellsCnt;
+    }
+  }
+  tree.prune(20);
+  EXPECT_LE(tree.getNodesCnt(), 20);
+  for (CtxLinks::Node node = 1; node < tree.getNodesCnt(); ++node) {
+    const auto ctx = ael::impl::dict::CtxCursor(tree, node);
+    EXPECT_EQ(tree.getLength(tree.getSuffix(node)) + 1, ctx.size());
+    if (tree.contains(ctx)) {
+      EXPECT_EQ(tree.at(ctx), static_cast<int>(ctx.size()));
+    }
+  }
+}
+
+TEST(CtxTree, NodesMatchLastWords) {
+  constexpr auto ctxLength = std::size_t{4};
+  auto gen = std::mt19937{42};
+  auto distr = std::uniform_int_distribution<std::uint64_t>(0, 3);
+  auto tree = CtxTree<int>(ctxLength);
+  auto nodes = std::map<std::vector<std::uint64_t>, CtxLinks::Node>{};
+  auto words = std::vector<std::uint64_t>{};
+  for (std::size_t i = 0; i < 1000; ++i) {
+    const auto ord = distr(gen);
+    tree.update(ord);
+    words.push_back(ord);
+    auto ctx = tree.getCurrCtx();
+    for (auto length = ctx.size(); length != 0; --length, ctx.pop_back()) {
+      const auto key = std::vector<std::uint64_t>(words.end() - length,
+                                                  words.end());
+      const auto [nodeIt, inserted] = nodes.emplace(key, ctx.getNode());
+      EXPECT_EQ(nodeIt->second, ctx.getNode());
+      EXPECT_EQ(ctx.size(), length);
+    }
+  }
+  EXPECT_EQ(tree.getNodesCnt(), nodes.size() + 1);
+}
+
+}  // namespace
+
+// NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <ael/impl/dictionary/cumulative_real_unique_count.hpp>
+#include <cstdint>
+#include <random>
+#include <ranges>
+#include <vector>
+
+using ael::impl::dict::CountsLayout;
+using ael::impl::dict::CumulativeRealUniqueCount;
+
+// NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
+
+TEST(CumulativeRealUniqueCount, FuzzAgainstPrefixSums) {
+  constexpr auto maxOrd = std::uint64_t{37};
+  for (const auto layout : {CountsLayout::sparse, CountsLayout::dense}) {
+    auto gen = std::mt19937(42);
+    auto cnts = CumulativeRealUniqueCount(maxOrd, layout);
+    auto realCnts = std::vector<std::uint64_t>(maxOrd, 0);
+    for (auto i : std::ranges::iota_view(0, 500)) {
+      const auto ord = gen() % maxOrd;
+      const auto cnt = gen() % 3 + 1;
+      cnts.increaseOrdCount(ord, cnt);
+      realCnts[ord] += cnt;
+      if (i % 100 == 99) {
+        cnts.halveCounts();
+        for (auto& realCnt : realCnts) {
+          realCnt -= realCnt / 2;
+        }
+      }
+    }
+    auto realLower = std::uint64_t{0};
+    auto uniqueLower = std::uint64_t{0};
+    for (auto ord : std::ranges::iota_view(std::uint64_t{0}, maxOrd)) {
+      const auto [real, unique] = cnts.getLowerCumulativeCnts(ord);
+      EXPECT_EQ(real, realLower);
+      EXPECT_EQ(unique, uniqueLower);
+      EXPECT_EQ(cnts.getRealCount(ord), realCnts[ord]);
+      realLower += realCnts[ord];
+      uniqueLower += realCnts[ord] != 0 ? 1 : 0;
+    }
+    EXPECT_EQ(cnts.getRealTotalWordsCnt(), realLower);
+    EXPECT_EQ(cnts.getUniqueTotalWordsCnt(), uniqueLower);
+  }
+}
+
+TEST(CumulativeRealUniqueCount, Rescale) {
+  auto cnts = CumulativeRealUniqueCount(8, CountsLayout::automatic, 10);
+  cnts.increaseOrdCount(1, 6);
+  cnts.increaseOrdCount(5, 5);
+
+  EXPECT_EQ(cnts.getRealCount(1), 3);
+  EXPECT_EQ(cnts.getRealCount(5), 3);
+  EXPECT_EQ(cnts.getRealTotalWordsCnt(), 6);
+  EXPECT_EQ(cnts.getUniqueTotalWordsCnt(), 2);
+}
+
+TEST(CumulativeRealUniqueCount, NthUnmetOrd) {
+  for (const auto layout : {CountsLayout::sparse, CountsLayout::dense}) {
+    auto cnts = CumulativeRealUniqueCount(10, layout);
+    cnts.increaseOrdCount(0, 1);
+    cnts.increaseOrdCount(3, 2);
+    cnts.increaseOrdCount(4, 1);
+
+    EXPECT_EQ(cnts.getNthUnmetOrd(0), 1);
+    EXPECT_EQ(cnts.getNthUnmetOrd(1), 2);
+    EXPECT_EQ(cnts.getNthUnmetOrd(2), 5);
+    EXPECT_EQ(cnts.getNthUnmetOrd(6), 9);
+  }
+}
+
+// NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
@@ -91,6 +91,64 @@ TEST(DataParser, ByteAfterBit1) {
   EXPECT_EQ(decoded.takeByte(), testData[1]);
 }
 
+TEST(DataParser, PeekBitsDoesNotMove) {
+  const auto testData =
+      std::array{std::byte{0b10100110}, std::byte{0b00110110}};
+  auto decoded = DataParser(testData);
+
+  EXPECT_EQ(decoded.peekBits(4), 0b1010);
+  EXPECT_EQ(decoded.peekBits(4), 0b1010);
+  EXPECT_TRUE(decoded.takeBit());
+}
+
+TEST(DataParser, TakeBitsCrossBytes) {
+  const auto testData =
+      std::array{std::byte{0b10100110}, std::byte{0b00110110}};
+  auto decoded = DataParser(testData);
+
+  EXPECT_EQ(decoded.takeBits(3), 0b101);
+  EXPECT_EQ(decoded.takeBits(9), 0b001100011);
+  EXPECT_EQ(decoded.takeBits(4), 0b0110);
+}
+
+TEST(DataParser, TakeBitsZeroPadding) {
+  const auto testData = std::array{std::byte{0b10100111}};
+  auto decoded = DataParser(testData);
+
+  EXPECT_EQ(decoded.takeBits(5), 0b10100);
+  EXPECT_EQ(decoded.takeBits(7), 0b1110000);
+  EXPECT_EQ(decoded.takeBits(20), 0);
+  EXPECT_FALSE(decoded.takeBit());
+}
+
+TEST(DataParser, TakeBitsLongData) {
+  auto testData = std::vector<std::byte>();
+  for (std::size_t i = 0; i < 40; ++i) {
+    testData.push_back(static_cast<std::byte>(i * 37 + 11));
+  }
+  auto decoded = DataParser(testData);
+  auto bitByBit = DataParser(testData);
+
+  for (const std::size_t num : {1, 7, 13, 56, 3, 0, 33, 56, 21, 40}) {
+    auto expected = std::uint64_t{0};
+    for (std::size_t i = 0; i < num; ++i) {
+      expected = (expected << 1) | (bitByBit.takeBit() ? 1 : 0);
+    }
+    EXPECT_EQ(decoded.takeBits(num), expected);
+  }
+}
+
+TEST(DataParser, SkipBits) {
+  auto testData = std::vector<std::byte>(20, std::byte{0});
+  testData[15] = std::byte{0b00010000};
+  auto decoded = DataParser(testData);
+
+  decoded.skipBits(3);
+  decoded.skipBits(120);
+  EXPECT_TRUE(decoded.takeBit());
+  EXPECT_EQ(decoded.takeBits(4), 0);
+}
+
 TEST(DataParser, UInt16T) {
   const auto testData =
       std::array{std::byte{0b01100010}, std::byte{0b00100110}};
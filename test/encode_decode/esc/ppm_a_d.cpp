@@ -121,12 +121,51 @@ TYPED_TEST_P(EscPPMADEncodeDecodeTest, EncodesAndDecodesWithBitsLimit) {
   }
 };
 
+TYPED_TEST_P(EscPPMADEncodeDecodeTest, EncodesAndDecodesRescaled) {
+  for (auto iteration : rng::iota_view(0, 15)) {
+    this->refreshForFuzzTest();
+    const auto rescaleThreshold = std::uint64_t{this->maxOrd + 5};
+
+    auto dict0 = TypeParam({this->maxOrd, 5, rescaleThreshold});
+    const auto [dataConstructor, wordsCnt, bitsCnt] =
+        ArithmeticCoder().encode(this->encoded, dict0).finalize();
+
+    auto dict1 = TypeParam({this->maxOrd, 5, rescaleThreshold});
+    auto parser = ael::DataParser(dataConstructor->getDataSpan());
+    ArithmeticDecoder(parser, bitsCnt).decode(dict1, this->outIter, wordsCnt);
+
+    EXPECT_TRUE(rng::equal(this->encoded, this->decoded));
+  }
+};
+
+TYPED_TEST_P(EscPPMADEncodeDecodeTest, EncodesAndDecodesCtxsLimited) {
+  using ael::impl::dict::CtxsLimitPolicy;
+  for (const auto policy : {CtxsLimitPolicy::restart, CtxsLimitPolicy::prune,
+                            CtxsLimitPolicy::freeze}) {
+    this->refreshForFuzzTest();
+    const auto constructInfo = typename TypeParam::ConstructInfo{
+        this->maxOrd, 5, ael::impl::dict::noRescale, 64, policy};
+
+    auto dict0 = TypeParam(constructInfo);
+    const auto [dataConstructor, wordsCnt, bitsCnt] =
+        ArithmeticCoder().encode(this->encoded, dict0).finalize();
+
+    auto dict1 = TypeParam(constructInfo);
+    auto parser = ael::DataParser(dataConstructor->getDataSpan());
+    ArithmeticDecoder(parser, bitsCnt).decode(dict1, this->outIter, wordsCnt);
+
+    EXPECT_TRUE(rng::equal(this->encoded, this->decoded));
+  }
+};
+
 REGISTER_TYPED_TEST_SUITE_P(EscPPMADEncodeDecodeTest, EncodeEmpty, DecodeEmpty,
                             EncodeSmall, EncodeDecodeEmptySequence,
                             EncodeDecodeSmallSequence,
                             EncodeDecodeSmallSequenceBitsLimit,
                             EncodesAndDecodesWithNoBitsLimit,
-                            EncodesAndDecodesWithBitsLimit);
+                            EncodesAndDecodesWithBitsLimit,
+                            EncodesAndDecodesRescaled,
+                            EncodesAndDecodesCtxsLimited);
 
 using Types = ::testing::Types<ael::esc::dict::PPMADictionary,
                                ael::esc::dict::PPMDDictionary>;
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <ael/data_parser.hpp>
+#include <ael/dictionary/adaptive_a_dictionary.hpp>
+#include <ael/dictionary/adaptive_d_dictionary.hpp>
+#include <ael/esc/arithmetic_coder.hpp>
+#include <ael/esc/arithmetic_decoder.hpp>
+#include <ael/esc/dictionary/sparse_alphabet_dictionary.hpp>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,
+// cppcoreguidelines-avoid-non-const-global-variables)
+
+namespace {
+
+namespace rng = std::ranges;
+using ael::esc::ArithmeticCoder;
+using ael::esc::ArithmeticDecoder;
+using ael::esc::dict::SparseAlphabetDictionary;
+
+template <class DictT>
+class EscSparseAlphabetEncodeDecodeTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(EscSparseAlphabetEncodeDecodeTest);
+
+TYPED_TEST_P(EscSparseAlphabetEncodeDecodeTest, HugeSparseIds) {
+  constexpr auto maxOrd = std::uint64_t{1} << 62;
+  constexpr auto maxDenseOrd = std::uint64_t{64};
+  auto gen = std::mt19937_64(42);
+  auto ids = std::vector<std::uint64_t>{};
+  for (auto i : rng::iota_view(0, 50)) {
+    ids.push_back(gen() % maxOrd);
+  }
+  auto encoded = std::vector<std::uint64_t>{};
+  for (auto i : rng::iota_view(0, 3000)) {
+    // Skewed, so that some ids are frequent.
+    encoded.push_back(ids[(gen() % ids.size()) * (gen() % ids.size()) /
+                          ids.size()]);
+  }
+
+  auto dict0 = SparseAlphabetDictionary<TypeParam>(maxOrd, maxDenseOrd);
+  auto [dataConstructor, wordsCnt, bitsCnt] =
+      ArithmeticCoder().encode(encoded, dict0).finalize();
+  // Most words cost a few bits, not the 62 bits of a raw id.
+  EXPECT_LT(bitsCnt, encoded.size() * 8);
+
+  auto decoded = std::vector<std::uint64_t>{};
+  auto dict1 = SparseAlphabetDictionary<TypeParam>(maxOrd, maxDenseOrd);
+  auto parser = ael::DataParser(dataConstructor->getDataSpan());
+  ArithmeticDecoder(parser, bitsCnt)
+      .decode(dict1, std::back_inserter(decoded), wordsCnt);
+
+  EXPECT_TRUE(rng::equal(encoded, decoded));
+  EXPECT_EQ(dict1.getMetWordsCnt(), dict0.getMetWordsCnt());
+}
+
+REGISTER_TYPED_TEST_SUITE_P(EscSparseAlphabetEncodeDecodeTest, HugeSparseIds);
+
+using Types = ::testing::Types<ael::dict::AdaptiveADictionary,
+                               ael::dict::AdaptiveDDictionary>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(EscSparseAlphabetEncodeDecode,
+                               EscSparseAlphabetEncodeDecodeTest, Types);
+
+}  // namespace
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,
+// cppcoreguidelines-avoid-non-const-global-variables)
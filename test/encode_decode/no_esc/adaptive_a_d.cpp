@@ -6,6 +6,8 @@
 #include <ael/data_parser.hpp>
 #include <ael/dictionary/adaptive_a_dictionary.hpp>
 #include <ael/dictionary/adaptive_d_dictionary.hpp>
+#include <ael/dictionary/narrow_adaptive_a_dictionary.hpp>
+#include <ael/dictionary/narrow_adaptive_d_dictionary.hpp>
 #include <encode_decode_test.hpp>
 #include <random>
 
@@ -118,18 +120,61 @@ TYPED_TEST_P(AdaptiveADEncodeDecodeTest, EncodesAndDecodesBitsLimit) {
   }
 }
 
+TYPED_TEST_P(AdaptiveADEncodeDecodeTest, EncodeDecodeLongSkewedSequence) {
+  // Few words of a big alphabet make narrow dictionaries rescale often.
+  this->encoded = this->generateEncoded(20000, 16);
+
+  auto dict0 = TypeParam(256);
+  const auto [dataConstructor, wordsCnt, bitsCnt] =
+      ArithmeticCoder().encode(this->encoded, dict0).finalize();
+
+  auto dict1 = TypeParam(256);
+  auto parser = ael::DataParser(dataConstructor->getDataSpan());
+  ArithmeticDecoder(parser, bitsCnt).decode(dict1, this->outIter, wordsCnt);
+
+  EXPECT_TRUE(rng::equal(this->encoded, this->decoded));
+}
+
 REGISTER_TYPED_TEST_SUITE_P(AdaptiveADEncodeDecodeTest, EncodeEmpty,
                             DecodeEmpty, EncodeSmall, EncodeDecodeEmptySequence,
                             EncodeDecodeSmallSequence,
                             EncodeDecodeSmallSequenceBitsLimit,
-                            EncodeDecodeFuzz, EncodesAndDecodesBitsLimit);
+                            EncodeDecodeFuzz, EncodesAndDecodesBitsLimit,
+                            EncodeDecodeLongSkewedSequence);
 
 using Types = ::testing::Types<ael::dict::AdaptiveADictionary,
-                               ael::dict::AdaptiveDDictionary>;
+                               ael::dict::AdaptiveDDictionary,
+                               ael::dict::NarrowAdaptiveADictionary,
+                               ael::dict::NarrowAdaptiveDDictionary>;
 
 INSTANTIATE_TYPED_TEST_SUITE_P(AdaptiveADEncodeDecode,
                                AdaptiveADEncodeDecodeTest, Types);
 
+template <class DictT>
+void checkRescaledEncodeDecode() {
+  const auto encoded = EncodeDecodeTest<DictT>::generateEncoded(20000, 16);
+  constexpr auto rescaleThreshold = std::uint64_t{1000};
+
+  auto dict0 =
+      DictT(256, ael::impl::dict::CountsLayout::automatic, rescaleThreshold);
+  const auto [dataConstructor, wordsCnt, bitsCnt] =
+      ArithmeticCoder().encode(encoded, dict0).finalize();
+
+  auto decoded = std::vector<std::uint64_t>{};
+  auto dict1 =
+      DictT(256, ael::impl::dict::CountsLayout::automatic, rescaleThreshold);
+  auto parser = ael::DataParser(dataConstructor->getDataSpan());
+  ArithmeticDecoder(parser, bitsCnt)
+      .decode(dict1, std::back_inserter(decoded), wordsCnt);
+
+  EXPECT_EQ(decoded, encoded);
+}
+
+TEST(AdaptiveADEncodeDecode, EncodeDecodeRescaled) {
+  checkRescaledEncodeDecode<ael::dict::AdaptiveADictionary>();
+  checkRescaledEncodeDecode<ael::dict::AdaptiveDDictionary>();
+}
+
 }  // namespace
 
 // NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
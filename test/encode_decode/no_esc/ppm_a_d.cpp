@@ -9,6 +9,7 @@
 #include <encode_decode_test.hpp>
 #include <ord_generator.hpp>
 #include <random>
+#include <stdexcept>
 
 // NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
 // cert-err58-cpp)
@@ -121,11 +122,65 @@ TYPED_TEST_P(PPMADEncodeDecodeTest, EncodesAndDecodesBitsLimit) {
   }
 }
 
+TYPED_TEST_P(PPMADEncodeDecodeTest, EncodesAndDecodesRescaled) {
+  for (auto iteration : rng::iota_view(0, 15)) {
+    this->refreshForFuzzTest();
+    const std::size_t ctxLen = this->gen() % 6;  // [0..6)
+    const auto rescaleThreshold = std::uint64_t{this->maxOrd + 5};
+
+    auto dict0 = TypeParam({this->maxOrd, ctxLen, rescaleThreshold});
+    auto [dataConstructor, wordsCnt, bitsCnt] =
+        ArithmeticCoder().encode(this->encoded, dict0).finalize();
+
+    auto dict1 = TypeParam({this->maxOrd, ctxLen, rescaleThreshold});
+    auto parser = ael::DataParser(dataConstructor->getDataSpan());
+    ArithmeticDecoder(parser, bitsCnt).decode(dict1, this->outIter, wordsCnt);
+
+    EXPECT_TRUE(rng::equal(this->encoded, this->decoded));
+  }
+}
+
+TYPED_TEST_P(PPMADEncodeDecodeTest, EncodesAndDecodesCtxsLimited) {
+  using ael::impl::dict::CtxsLimitPolicy;
+  for (const auto policy : {CtxsLimitPolicy::restart, CtxsLimitPolicy::prune,
+                            CtxsLimitPolicy::freeze}) {
+    this->refreshForFuzzTest();
+    const std::size_t ctxLen = 1 + this->gen() % 5;  // [1..6)
+    const auto constructInfo = typename TypeParam::ConstructInfo{
+        this->maxOrd, ctxLen, ael::impl::dict::noRescale, 64, policy};
+
+    auto dict0 = TypeParam(constructInfo);
+    auto [dataConstructor, wordsCnt, bitsCnt] =
+        ArithmeticCoder().encode(this->encoded, dict0).finalize();
+
+    auto dict1 = TypeParam(constructInfo);
+    auto parser = ael::DataParser(dataConstructor->getDataSpan());
+    ArithmeticDecoder(parser, bitsCnt).decode(dict1, this->outIter, wordsCnt);
+
+    EXPECT_TRUE(rng::equal(this->encoded, this->decoded));
+  }
+}
+
+TYPED_TEST_P(PPMADEncodeDecodeTest, TooSmallCtxsLimit) {
+  using Info = typename TypeParam::ConstructInfo;
+  EXPECT_THROW(TypeParam(Info{6, 4, ael::impl::dict::noRescale, 14}),
+               std::logic_error);
+  EXPECT_NO_THROW(TypeParam(Info{6, 4, ael::impl::dict::noRescale, 15}));
+}
+
+TYPED_TEST_P(PPMADEncodeDecodeTest, RescaleAllowsLongerContexts) {
+  EXPECT_THROW(TypeParam({256, 16}), std::logic_error);
+  EXPECT_NO_THROW(TypeParam({256, 16, (1 << 14) - 1}));
+}
+
 REGISTER_TYPED_TEST_SUITE_P(PPMADEncodeDecodeTest, EncodeEmpty, DecodeEmpty,
                             EncodeSmall, EncodeDecodeEmptySequence,
                             EncodeDecodeSmallSequence,
                             EncodeDecodeSmallSequenceBitsLimit,
-                            EncodesAndDecodes, EncodesAndDecodesBitsLimit);
+                            EncodesAndDecodes, EncodesAndDecodesBitsLimit,
+                            EncodesAndDecodesRescaled,
+                            EncodesAndDecodesCtxsLimited, TooSmallCtxsLimit,
+                            RescaleAllowsLongerContexts);
 
 using Types =
     ::testing::Types<ael::dict::PPMADictionary, ael::dict::PPMDDictionary>;
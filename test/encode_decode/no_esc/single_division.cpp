@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <ael/arithmetic_coder.hpp>
+#include <ael/arithmetic_decoder.hpp>
+#include <ael/byte_data_constructor.hpp>
+#include <ael/data_parser.hpp>
+#include <ael/dictionary/adaptive_a_dictionary.hpp>
+#include <ael/dictionary/adaptive_d_dictionary.hpp>
+#include <ael/impl/ranges_calc.hpp>
+#include <encode_decode_test.hpp>
+#include <random>
+
+// NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
+
+namespace {
+
+namespace rng = std::ranges;
+using ael::ArithmeticCoder;
+using ael::ArithmeticDecoder;
+
+template <class DictT>
+class SingleDivision : public DictT {
+ public:
+  using DictT::DictT;
+  constexpr static auto rangesCalcMode =
+      ael::impl::RangesCalcMode::singleDivision;
+};
+
+template <class DictT>
+using SingleDivisionEncodeDecodeTest = EncodeDecodeTest<DictT>;
+
+TYPED_TEST_SUITE_P(SingleDivisionEncodeDecodeTest);
+
+TYPED_TEST_P(SingleDivisionEncodeDecodeTest, EncodeDecodeSmallSequence) {
+  auto dict0 = SingleDivision<TypeParam>(8);
+  const auto [dataConstructor, wordsCnt, bitsCnt] =
+      ArithmeticCoder().encode(this->smallSequence, dict0).finalize();
+
+  auto dict1 = SingleDivision<TypeParam>(8);
+  auto parser = ael::DataParser(dataConstructor->getDataSpan());
+  ArithmeticDecoder(parser, bitsCnt).decode(dict1, this->outIter, wordsCnt);
+
+  EXPECT_TRUE(rng::equal(this->smallSequence, this->decoded));
+}
+
+TYPED_TEST_P(SingleDivisionEncodeDecodeTest, EncodeDecodeFuzz) {
+  for (auto iteration : rng::iota_view(0, 15)) {
+    this->refreshForFuzzTest();
+
+    auto dict0 = SingleDivision<TypeParam>(this->maxOrd);
+    const auto [dataConstructor, wordsCnt, bitsCnt] =
+        ArithmeticCoder().encode(this->encoded, dict0).finalize();
+
+    auto dict1 = SingleDivision<TypeParam>(this->maxOrd);
+    auto parser = ael::DataParser(dataConstructor->getDataSpan());
+    ArithmeticDecoder(parser, bitsCnt).decode(dict1, this->outIter, wordsCnt);
+
+    EXPECT_TRUE(rng::equal(this->encoded, this->decoded));
+  }
+}
+
+TYPED_TEST_P(SingleDivisionEncodeDecodeTest, CompressionLossIsSmall) {
+  auto gen = std::mt19937(13);
+  auto distr = std::geometric_distribution<std::uint64_t>(0.3);
+  auto encoded = std::vector<std::uint64_t>();
+  for (auto _ : rng::iota_view(0, 20000)) {
+    encoded.push_back(std::min<std::uint64_t>(distr(gen), 255));
+  }
+
+  auto exactDict = TypeParam(256);
+  const auto exactBits =
+      ArithmeticCoder().encode(encoded, exactDict).finalize().bitsEncoded;
+  auto singleDivisionDict = SingleDivision<TypeParam>(256);
+  const auto singleDivisionBits = ArithmeticCoder()
+                                      .encode(encoded, singleDivisionDict)
+                                      .finalize()
+                                      .bitsEncoded;
+
+  EXPECT_LE(static_cast<double>(singleDivisionBits),
+            static_cast<double>(exactBits) * 1.001 + 16);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SingleDivisionEncodeDecodeTest,
+                            EncodeDecodeSmallSequence, EncodeDecodeFuzz,
+                            CompressionLossIsSmall);
+
+using Types = ::testing::Types<ael::dict::AdaptiveADictionary,
+                               ael::dict::AdaptiveDDictionary>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(SingleDivisionEncodeDecode,
+                               SingleDivisionEncodeDecodeTest, Types);
+
+}  // namespace
+
+// NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
@@ -19,6 +19,14 @@ using ael::ArithmeticDecoder;
 
 using UniformEncodeDecode = EncodeDecodeTest<ael::dict::UniformDictionary>;
 
+class DivisionUniformDictionary : public ael::dict::UniformDictionary {
+ public:
+  using UniformDictionary::UniformDictionary;
+  [[nodiscard]] std::uint16_t getTotalWordsCntLog2() const {
+    return ael::impl::dict::unknownTotalWordsCntLog2;
+  }
+};
+
 TEST_F(UniformEncodeDecode, EncodeEmpty) {
   auto dict = ael::dict::UniformDictionary(6);
   auto [dataConstructor, wordsCnt, bitsCnt] =
@@ -117,6 +125,27 @@ TEST_F(UniformEncodeDecode, EncodeDecodeFuzzBitsLimit) {
   }
 }
 
+TEST_F(UniformEncodeDecode, PowerOfTwoShiftsMatchDivisions) {
+  encoded = generateEncoded(1000, 1024);
+
+  auto shiftDict0 = ael::dict::UniformDictionary(1024);
+  const auto [shiftData, shiftWordsCnt, shiftBitsCnt] =
+      ArithmeticCoder().encode(encoded, shiftDict0).finalize();
+  auto divisionDict = DivisionUniformDictionary(1024);
+  const auto [divisionData, _0, divisionBitsCnt] =
+      ArithmeticCoder().encode(encoded, divisionDict).finalize();
+
+  EXPECT_EQ(shiftBitsCnt, divisionBitsCnt);
+  EXPECT_TRUE(rng::equal(shiftData->getDataSpan(), divisionData->getDataSpan()));
+
+  auto shiftDict1 = ael::dict::UniformDictionary(1024);
+  auto parser = ael::DataParser(shiftData->getDataSpan());
+  ArithmeticDecoder(parser, shiftBitsCnt)
+      .decode(shiftDict1, outIter, shiftWordsCnt);
+
+  EXPECT_TRUE(rng::equal(encoded, decoded));
+}
+
 }  // namespace
 
 // NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
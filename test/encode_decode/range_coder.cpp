@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <ael/arithmetic_coder.hpp>
+#include <ael/data_parser.hpp>
+#include <ael/dictionary/adaptive_a_contextual_dictionary.hpp>
+#include <ael/dictionary/adaptive_a_dictionary.hpp>
+#include <ael/dictionary/adaptive_d_dictionary.hpp>
+#include <ael/dictionary/narrow_adaptive_a_dictionary.hpp>
+#include <ael/dictionary/ppma_dictionary.hpp>
+#include <ael/dictionary/normalize_counts.hpp>
+#include <ael/dictionary/ppmd_dictionary.hpp>
+#include <ael/dictionary/static_dictionary.hpp>
+#include <ael/dictionary/uniform_dictionary.hpp>
+#include <ael/range_coder.hpp>
+#include <ael/range_decoder.hpp>
+#include <encode_decode_test.hpp>
+#include <map>
+#include <stdexcept>
+
+// NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
+
+namespace {
+
+namespace rng = std::ranges;
+using ael::RangeCoder;
+using ael::RangeDecoder;
+
+template <class DictT>
+DictT makeDict(std::uint64_t maxOrd) {
+  if constexpr (std::is_same_v<DictT, ael::dict::PPMADictionary> ||
+                std::is_same_v<DictT, ael::dict::PPMDDictionary>) {
+    return DictT({maxOrd, 2});
+  } else if constexpr (std::is_same_v<
+                           DictT, ael::dict::AdaptiveAContextualDictionary>) {
+    return DictT({8, 2, 4});
+  } else {
+    return DictT(maxOrd);
+  }
+}
+
+template <class DictT>
+using RangeCoderEncodeDecodeTest = EncodeDecodeTest<DictT>;
+
+TYPED_TEST_SUITE_P(RangeCoderEncodeDecodeTest);
+
+TYPED_TEST_P(RangeCoderEncodeDecodeTest, EncodeEmpty) {
+  auto dict = makeDict<TypeParam>(6);
+  auto [dataConstructor, wordsCnt, bitsCnt] =
+      RangeCoder().encode(this->encoded, dict).finalize();
+
+  EXPECT_EQ(wordsCnt, 0);
+  EXPECT_EQ(bitsCnt, 0);
+  EXPECT_EQ(dataConstructor->size(), 0);
+}
+
+TYPED_TEST_P(RangeCoderEncodeDecodeTest, EncodeDecodeSmallSequence) {
+  auto dict0 = makeDict<TypeParam>(8);
+  auto [dataConstructor, wordsCnt, bitsCnt] =
+      RangeCoder().encode(this->smallSequence, dict0).finalize();
+
+  EXPECT_EQ(bitsCnt, dataConstructor->size() * 8);
+
+  auto dict1 = makeDict<TypeParam>(8);
+  auto parser = ael::DataParser(dataConstructor->getDataSpan());
+  RangeDecoder(parser).decode(dict1, this->outIter, wordsCnt);
+
+  EXPECT_TRUE(rng::equal(this->smallSequence, this->decoded));
+}
+
+TYPED_TEST_P(RangeCoderEncodeDecodeTest, EncodeDecodeFuzz) {
+  for (auto iteration : rng::iota_view(0, 15)) {
+    this->refreshForFuzzTest();
+
+    auto dict0 = makeDict<TypeParam>(this->maxOrd);
+    const auto [dataConstructor, wordsCnt, bitsCnt] =
+        RangeCoder().encode(this->encoded, dict0).finalize();
+
+    auto dict1 = makeDict<TypeParam>(this->maxOrd);
+    auto parser = ael::DataParser(dataConstructor->getDataSpan());
+    RangeDecoder(parser, bitsCnt).decode(dict1, this->outIter, wordsCnt);
+
+    EXPECT_TRUE(rng::equal(this->encoded, this->decoded));
+  }
+}
+
+TYPED_TEST_P(RangeCoderEncodeDecodeTest, SizeCloseToArithmeticCoder) {
+  this->encoded = this->generateEncoded(5000, 200);
+
+  auto dict0 = makeDict<TypeParam>(256);
+  const auto [rangeData, _0, rangeBitsCnt] =
+      RangeCoder().encode(this->encoded, dict0).finalize();
+  auto dict1 = makeDict<TypeParam>(256);
+  const auto [arithmeticData, _1, arithmeticBitsCnt] =
+      ael::ArithmeticCoder().encode(this->encoded, dict1).finalize();
+
+  EXPECT_LE(rangeBitsCnt, arithmeticBitsCnt + arithmeticBitsCnt / 1000 + 64);
+}
+
+TYPED_TEST_P(RangeCoderEncodeDecodeTest, FollowingDataDoesNotMatter) {
+  this->encoded = this->generateEncoded(300, 50);
+
+  auto dict0 = makeDict<TypeParam>(64);
+  auto [dataConstructor, wordsCnt, bitsCnt] =
+      RangeCoder().encode(this->encoded, dict0).finalize();
+  dataConstructor->putBitsRepeat(true, 300);
+
+  auto dict1 = makeDict<TypeParam>(64);
+  auto parser = ael::DataParser(dataConstructor->getDataSpan());
+  RangeDecoder(parser).decode(dict1, this->outIter, wordsCnt);
+
+  EXPECT_TRUE(rng::equal(this->encoded, this->decoded));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(RangeCoderEncodeDecodeTest, EncodeEmpty,
+                            EncodeDecodeSmallSequence, EncodeDecodeFuzz,
+                            SizeCloseToArithmeticCoder,
+                            FollowingDataDoesNotMatter);
+
+using Types = ::testing::Types<
+    ael::dict::UniformDictionary, ael::dict::AdaptiveADictionary,
+    ael::dict::AdaptiveDDictionary, ael::dict::NarrowAdaptiveADictionary,
+    ael::dict::AdaptiveAContextualDictionary, ael::dict::PPMADictionary,
+    ael::dict::PPMDDictionary>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(RangeCoder, RangeCoderEncodeDecodeTest, Types);
+
+using RangeCoderMultipleDictionaries =
+    EncodeDecodeTest<ael::dict::AdaptiveADictionary>;
+
+TEST_F(RangeCoderMultipleDictionaries, EncodeDecode) {
+  // Dictionaries have windows of 62, 31 and 240 bits.
+  const auto first = generateEncoded(1000, 256);
+  const auto second = generateEncoded(1000, 100);
+  const auto third = generateEncoded(1000, 256);
+  const auto fourth = generateEncoded(1000, 16);
+
+  auto encodeDictA = ael::dict::AdaptiveADictionary(256);
+  auto encodeDictNarrow = ael::dict::NarrowAdaptiveADictionary(100);
+  auto encodeDictPPMD = ael::dict::PPMDDictionary({256, 2});
+  auto encodeDictUniform = ael::dict::UniformDictionary(16);
+  auto [dataConstructor, wordsCnt, bitsCnt] =
+      RangeCoder()
+          .encode(first, encodeDictA)
+          .encode(second, encodeDictNarrow)
+          .encode(third, encodeDictPPMD)
+          .encode(fourth, encodeDictUniform)
+          .finalize();
+
+  EXPECT_EQ(wordsCnt, 4000);
+
+  auto decodeDictA = ael::dict::AdaptiveADictionary(256);
+  auto decodeDictNarrow = ael::dict::NarrowAdaptiveADictionary(100);
+  auto decodeDictPPMD = ael::dict::PPMDDictionary({256, 2});
+  auto decodeDictUniform = ael::dict::UniformDictionary(16);
+  auto parser = ael::DataParser(dataConstructor->getDataSpan());
+  auto decoder = RangeDecoder(parser, bitsCnt);
+  decoder.decode(decodeDictA, outIter, 1000);
+  decoder.decode(decodeDictNarrow, outIter, 1000);
+  decoder.decode(decodeDictPPMD, outIter, 1000);
+  decoder.decode(decodeDictUniform, outIter, 1000);
+
+  auto expected = first;
+  expected.insert(expected.end(), second.begin(), second.end());
+  expected.insert(expected.end(), third.begin(), third.end());
+  expected.insert(expected.end(), fourth.begin(), fourth.end());
+  EXPECT_TRUE(rng::equal(expected, decoded));
+}
+
+TEST_F(RangeCoderMultipleDictionaries, ThrowsOnTooBigTotal) {
+  const auto counts = std::map<std::uint64_t, std::uint64_t>{
+      {0, 5}, {1, 3}, {7, 1}, {200, 7}};
+  const auto sequence = std::vector<std::uint64_t>{0, 7, 200, 1, 0};
+  constexpr auto maxTotalLog2 = ael::dict::StaticDictionary::countNumBits - 8;
+
+  auto encodeDict = ael::dict::StaticDictionary(
+      256, ael::dict::normalizeCounts(counts, maxTotalLog2));
+  auto [dataConstructor, wordsCnt, bitsCnt] =
+      RangeCoder().encode(sequence, encodeDict).finalize();
+  auto decodeDict = ael::dict::StaticDictionary(
+      256, ael::dict::normalizeCounts(counts, maxTotalLog2));
+  auto parser = ael::DataParser(dataConstructor->getDataSpan());
+  RangeDecoder(parser, bitsCnt).decode(decodeDict, outIter, wordsCnt);
+  EXPECT_TRUE(rng::equal(sequence, decoded));
+
+  const auto bigCounts = ael::dict::normalizeCounts(counts, 60);
+  auto arithmeticDict = ael::dict::StaticDictionary(256, bigCounts);
+  EXPECT_NO_THROW(ael::ArithmeticCoder().encode(sequence, arithmeticDict));
+  auto rangeDict = ael::dict::StaticDictionary(256, bigCounts);
+  EXPECT_THROW(RangeCoder().encode(sequence, rangeDict), std::invalid_argument);
+}
+
+}  // namespace
+
+// NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
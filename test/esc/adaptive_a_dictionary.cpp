@@ -257,5 +257,25 @@ TEST(EscAdaptiveADictionary, Example) {
   }
 }
 
+TEST(EscAdaptiveADictionary, RescaleHalvesCounts) {
+  auto dict = AdaptiveADictionary(4, 10);
+  [[maybe_unused]] const auto stats2 = dict.getProbabilityStats(2);
+  for (std::size_t i = 0; i < 10; ++i) {
+    [[maybe_unused]] const auto stats1 = dict.getProbabilityStats(1);
+  }
+  // Total 11 exceeds 10: word 1 count is halved from 10 to 5, word 2 count 1
+  // is rounded up.
+  const auto stats1 = dict.getProbabilityStats(1);
+  ASSERT_EQ(stats1.size(), 1);
+  EXPECT_EQ(stats1[0].low, 0);
+  EXPECT_EQ(stats1[0].high, 5);
+  EXPECT_EQ(stats1[0].total, 5 + 1 + 1);
+  const auto stats2Rescaled = dict.getProbabilityStats(2);
+  ASSERT_EQ(stats2Rescaled.size(), 1);
+  EXPECT_EQ(stats2Rescaled[0].low, 6);
+  EXPECT_EQ(stats2Rescaled[0].high, 7);
+  EXPECT_EQ(stats2Rescaled[0].total, 6 + 1 + 1);
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers,
 // cert-err58-cpp)
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <ael/dictionary/adaptive_a_dictionary.hpp>
+#include <ael/esc/dictionary/sparse_alphabet_dictionary.hpp>
+#include <cstdint>
+#include <stdexcept>
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers,
+// cert-err58-cpp)
+
+using SparseAlphabetDictionary =
+    ael::esc::dict::SparseAlphabetDictionary<ael::dict::AdaptiveADictionary>;
+
+namespace {
+
+constexpr auto hugeMaxOrd = std::uint64_t{1} << 62;
+
+}  // namespace
+
+TEST(EscSparseAlphabetDictionary, NewWordIsEscAndRawOrd) {
+  auto dict = SparseAlphabetDictionary(hugeMaxOrd, 4);
+  const auto wordOrd = (std::uint64_t{1} << 61) + 12345;
+
+  const auto stats = dict.getProbabilityStats(wordOrd);
+
+  ASSERT_EQ(stats.size(), 3);
+  EXPECT_EQ(stats[0].low, 0);
+  EXPECT_EQ(stats[0].high, 1);
+  EXPECT_EQ(stats[0].total, 5);
+  // Raw ord in two chunks: 30 high bits and 32 low bits.
+  EXPECT_EQ(stats[1].low, wordOrd >> 32);
+  EXPECT_EQ(stats[1].high, (wordOrd >> 32) + 1);
+  EXPECT_EQ(stats[1].total, hugeMaxOrd >> 32);
+  EXPECT_EQ(stats[2].low, 12345);
+  EXPECT_EQ(stats[2].high, 12346);
+  EXPECT_EQ(stats[2].total, std::uint64_t{1} << 32);
+  EXPECT_EQ(dict.getMetWordsCnt(), 1);
+}
+
+TEST(EscSparseAlphabetDictionary, SmallAlphabetRawOrdIsOneChunk) {
+  auto dict = SparseAlphabetDictionary(1000, 4);
+
+  const auto stats = dict.getProbabilityStats(999);
+
+  ASSERT_EQ(stats.size(), 2);
+  EXPECT_EQ(stats[1].low, 999);
+  EXPECT_EQ(stats[1].high, 1000);
+  EXPECT_EQ(stats[1].total, 1000);
+}
+
+TEST(EscSparseAlphabetDictionary, MetWordIsOneStats) {
+  auto dict = SparseAlphabetDictionary(hugeMaxOrd, 4);
+  const auto wordOrd = hugeMaxOrd - 1;
+  [[maybe_unused]] const auto stats0 = dict.getProbabilityStats(wordOrd);
+
+  const auto stats1 = dict.getProbabilityStats(wordOrd);
+
+  ASSERT_EQ(stats1.size(), 1);
+  EXPECT_EQ(dict.getWordOrd(stats1[0].low), wordOrd);
+  EXPECT_EQ(dict.getWordOrd(stats1[0].high - 1), wordOrd);
+  EXPECT_EQ(dict.getMetWordsCnt(), 1);
+}
+
+TEST(EscSparseAlphabetDictionary, GetWordOrdOnInitIsEsc) {
+  const auto dict = SparseAlphabetDictionary(hugeMaxOrd, 4);
+
+  const auto ord = dict.getWordOrd(0);
+
+  EXPECT_TRUE(dict.isEsc(ord));
+}
+
+TEST(EscSparseAlphabetDictionary, TooManyWords) {
+  auto dict = SparseAlphabetDictionary(hugeMaxOrd, 2);
+  [[maybe_unused]] const auto stats0 = dict.getProbabilityStats(7);
+  [[maybe_unused]] const auto stats1 = dict.getProbabilityStats(1u << 20);
+  [[maybe_unused]] const auto stats2 = dict.getProbabilityStats(7);
+
+  EXPECT_THROW([[maybe_unused]] auto stats = dict.getProbabilityStats(42),
+               std::length_error);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers,
+// cert-err58-cpp)
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <ael/dictionary/adaptive_a_dictionary.hpp>
+#include <ael/impl/dictionary/cumulative_real_unique_count.hpp>
+#include <ael/impl/dictionary/fenwick_tree.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <random>
+#include <ranges>
+#include <vector>
+
+using ael::impl::dict::CountsLayout;
+using ael::impl::dict::FenwickTree;
+
+// NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
+
+TEST(FenwickTree, Construct) {
+  [[maybe_unused]] auto tree = FenwickTree<std::uint64_t>(10);
+}
+
+TEST(FenwickTree, EmptyLowerCumulativeCnt) {
+  const auto tree = FenwickTree<std::uint64_t>(10);
+  for (auto ord : std::ranges::iota_view(0, 11)) {
+    EXPECT_EQ(tree.getLowerCumulativeCnt(ord), 0);
+  }
+}
+
+TEST(FenwickTree, SearchStep) {
+  EXPECT_EQ(FenwickTree<std::uint64_t>(1).getSearchStep(), 1);
+  EXPECT_EQ(FenwickTree<std::uint64_t>(7).getSearchStep(), 4);
+  EXPECT_EQ(FenwickTree<std::uint64_t>(8).getSearchStep(), 8);
+  EXPECT_EQ(FenwickTree<std::uint64_t>(9).getSearchStep(), 8);
+}
+
+TEST(FenwickTree, NodeCnt) {
+  auto tree = FenwickTree<std::uint64_t>(8);
+  tree.update(0, 1);
+  tree.update(2, 3);
+  tree.update(5, 7);
+  EXPECT_EQ(tree.getNodeCnt(1), 1);
+  EXPECT_EQ(tree.getNodeCnt(2), 1);
+  EXPECT_EQ(tree.getNodeCnt(3), 3);
+  EXPECT_EQ(tree.getNodeCnt(4), 4);
+  EXPECT_EQ(tree.getNodeCnt(6), 7);
+  EXPECT_EQ(tree.getNodeCnt(8), 11);
+}
+
+TEST(FenwickTree, FuzzAgainstPrefixSums) {
+  constexpr auto maxOrd = std::uint64_t{37};
+  for (const auto layout : {CountsLayout::sparse, CountsLayout::dense}) {
+    auto gen = std::mt19937(42);
+    auto tree = FenwickTree<std::uint64_t>(maxOrd, layout);
+    auto counts = std::vector<std::int64_t>(maxOrd, 0);
+    for (auto i : std::ranges::iota_view(0, 1000)) {
+      const auto ord = gen() % maxOrd;
+      const auto change = (counts[ord] > 0 && i % 3 == 0)
+                              ? -static_cast<std::int64_t>(gen() % counts[ord])
+                              : static_cast<std::int64_t>(gen() % 5);
+      tree.update(ord, change);
+      counts[ord] += change;
+    }
+    auto lower = std::uint64_t{0};
+    for (auto ord : std::ranges::iota_view(std::uint64_t{0}, maxOrd)) {
+      EXPECT_EQ(tree.getLowerCumulativeCnt(ord), lower);
+      EXPECT_EQ(tree.getCount(ord), counts[ord]);
+      lower += counts[ord];
+    }
+    EXPECT_EQ(tree.getLowerCumulativeCnt(maxOrd), lower);
+  }
+}
+
+TEST(FenwickTree, HalveCounts) {
+  constexpr auto maxOrd = std::uint64_t{13};
+  for (const auto layout : {CountsLayout::sparse, CountsLayout::dense}) {
+    auto tree = FenwickTree<std::uint64_t>(maxOrd, layout);
+    tree.update(0, 5);
+    tree.update(3, 1);
+    tree.update(7, 8);
+    tree.update(12, 2);
+
+    EXPECT_EQ(tree.halveCounts(), 2 + 4 + 1);
+
+    EXPECT_EQ(tree.getCount(0), 3);
+    EXPECT_EQ(tree.getCount(3), 1);
+    EXPECT_EQ(tree.getCount(7), 4);
+    EXPECT_EQ(tree.getCount(12), 1);
+    EXPECT_EQ(tree.getLowerCumulativeCnt(4), 4);
+    EXPECT_EQ(tree.getLowerCumulativeCnt(8), 8);
+    EXPECT_EQ(tree.getLowerCumulativeCnt(maxOrd), 9);
+  }
+}
+
+TEST(FenwickTree, StructCounts) {
+  using Counts = ael::impl::dict::CumulativeRealUniqueCount::Counts;
+  constexpr auto maxOrd = std::uint64_t{13};
+  for (const auto layout : {CountsLayout::sparse, CountsLayout::dense}) {
+    auto tree = FenwickTree<Counts>(maxOrd, layout);
+    tree.update(0, {5, 1});
+    tree.update(7, {8, 1});
+    tree.update(12, {2, 1});
+
+    // Dense tree passes counts of unmet ords too.
+    const auto decrease = tree.changeCounts([](Counts& cnts) {
+      const auto realDecrease = std::uint64_t{cnts.real != 0 ? 1U : 0U};
+      cnts.real -= realDecrease;
+      return Counts{realDecrease, 0};
+    });
+
+    EXPECT_EQ(decrease, (Counts{3, 0}));
+    EXPECT_EQ(tree.getCount(7), (Counts{7, 1}));
+    EXPECT_EQ(tree.getLowerCumulativeCnt(8), (Counts{11, 2}));
+    EXPECT_EQ(tree.getLowerCumulativeCnt(maxOrd), (Counts{12, 3}));
+  }
+}
+
+TEST(FenwickTree, HugeAlphabetDictionary) {
+  constexpr auto maxOrd = std::uint64_t{1} << 40;
+  auto dict = ael::dict::AdaptiveADictionary(maxOrd);
+  auto searchDict = ael::dict::AdaptiveADictionary(maxOrd);
+  for (const auto ord : {maxOrd - 1, std::uint64_t{0}, std::uint64_t{12345},
+                         maxOrd / 3, maxOrd - 1}) {
+    const auto [low, high, total] = dict.getProbabilityStats(ord);
+    EXPECT_EQ(searchDict.getWordOrd(low), ord);
+    EXPECT_EQ(searchDict.getWordOrd(high - 1), ord);
+    [[maybe_unused]] const auto stats = searchDict.getProbabilityStats(ord);
+  }
+}
+
+TEST(FenwickTree, AllocatesFromResource) {
+  // Global allocator is not reachable, so all nodes come from the buffer.
+  auto buffer = std::array<std::byte, 1 << 16>{};
+  auto resource = std::pmr::monotonic_buffer_resource(
+      buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+  constexpr auto maxOrd = std::uint64_t{1} << 40;
+  auto tree = FenwickTree<std::uint64_t>(maxOrd, CountsLayout::sparse,
+                                         &resource);
+  for (const auto ord : {maxOrd - 1, std::uint64_t{0}, maxOrd / 3}) {
+    tree.update(ord, 2);
+  }
+  EXPECT_EQ(tree.getLowerCumulativeCnt(maxOrd), 6);
+  EXPECT_EQ(tree.getCount(maxOrd / 3), 2);
+  EXPECT_THROW(FenwickTree<std::uint64_t>(1 << 20, CountsLayout::dense,
+                                          &resource),
+               std::bad_alloc);
+}
+
+// NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <ael/impl/multiply_and_divide.hpp>
+#include <cstdint>
+#include <limits>
+
+namespace bm = boost::multiprecision;
+
+// NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
+
+TEST(MultiplyAndDivide, Small64) {
+  EXPECT_EQ(ael::impl::multiply_and_divide(std::uint64_t{6}, std::uint64_t{7},
+                                           std::uint64_t{4}),
+            10);
+}
+
+TEST(MultiplyAndDivide, Small32) {
+  EXPECT_EQ(ael::impl::multiply_and_divide(std::uint32_t{6}, std::uint32_t{7},
+                                           std::uint32_t{4}),
+            10);
+}
+
+TEST(MultiplyAndDivide, WideProduct64) {
+  const auto left = std::uint64_t{1} << 62;
+  const auto right = std::uint64_t{0xFFFFFFFFFFF1};
+  const auto divider = std::uint64_t{0xFFFFFFFFFFF3};
+  const auto expected =
+      (bm::uint128_t{left} * right / divider).convert_to<std::uint64_t>();
+  EXPECT_EQ(ael::impl::multiply_and_divide(left, right, divider), expected);
+}
+
+TEST(MultiplyAndDivide, WideProduct32) {
+  const auto max = std::numeric_limits<std::uint32_t>::max();
+  EXPECT_EQ(ael::impl::multiply_and_divide(max, max - 1, max), max - 1);
+}
+
+TEST(MultiplyDecreaseAndDivide, Exact) {
+  EXPECT_EQ(ael::impl::multiply_decrease_and_divide(
+                std::uint64_t{6}, std::uint64_t{8}, std::uint64_t{4}),
+            11);
+}
+
+TEST(MultiplyDecreaseAndDivide, WideProduct64) {
+  const auto left = (std::uint64_t{1} << 62) - 3;
+  const auto right = std::uint64_t{1} << 40;
+  const auto divider = (std::uint64_t{1} << 62) - 1;
+  const auto expected = ((bm::uint128_t{left} * right - 1) / divider)
+                            .convert_to<std::uint64_t>();
+  EXPECT_EQ(ael::impl::multiply_decrease_and_divide(left, right, divider),
+            expected);
+}
+
+TEST(MultiplyAndDivide, WideNum256) {
+  using Num = ael::impl::WideNum<256>;
+  const auto left = Num{1} << 240;
+  const auto right = Num{3};
+  const auto divider = Num{6};
+  EXPECT_EQ(ael::impl::multiply_and_divide(left, right, divider), Num{1} << 239);
+}
+
+// NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
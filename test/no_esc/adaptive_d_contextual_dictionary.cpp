@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <ael/dictionary/adaptive_d_contextual_dictionary.hpp>
+#include <ael/dictionary/adaptive_d_dictionary.hpp>
+#include <cstdint>
+#include <random>
 
 using ael::dict::AdaptiveDContextualDictionary;
 
@@ -95,5 +98,38 @@ TEST(AdaptiveDContextualDictionary, Example) {
   EXPECT_EQ(total7, 250 * 14);
 }
 
+TEST(AdaptiveDContextualDictionary, RescaleHalvesCounts) {
+  // Without contexts the model is the empty context one.
+  auto noCtxDict = AdaptiveDContextualDictionary({8, 0, 8, 50});
+  auto dict = ael::dict::AdaptiveDDictionary(
+      256, ael::impl::dict::CountsLayout::automatic, 50);
+  auto gen = std::mt19937(42);
+  for (std::size_t i = 0; i < 500; ++i) {
+    const auto ord = std::uint64_t{gen() % 8};
+    const auto [low, high, total] = dict.getProbabilityStats(ord);
+    const auto [noCtxLow, noCtxHigh, noCtxTotal] =
+        noCtxDict.getProbabilityStats(ord);
+    ASSERT_EQ(noCtxLow, low);
+    ASSERT_EQ(noCtxHigh, high);
+    ASSERT_EQ(noCtxTotal, total);
+  }
+
+  // Context {1} meets only word 1, so its total grows with its real count.
+  auto ctxDict = AdaptiveDContextualDictionary({8, 1, 8, 10});
+  auto noRescaleCtxDict = AdaptiveDContextualDictionary({8, 1, 8});
+  auto thresholdDict = ael::dict::AdaptiveDDictionary(256);
+  for (std::size_t i = 0; i < 10; ++i) {
+    [[maybe_unused]] const auto stats = thresholdDict.getProbabilityStats(1);
+  }
+  for (std::size_t i = 0; i < 100; ++i) {
+    [[maybe_unused]] const auto stats = ctxDict.getProbabilityStats(1);
+    [[maybe_unused]] const auto noRescaleStats =
+        noRescaleCtxDict.getProbabilityStats(1);
+  }
+  EXPECT_LE(ctxDict.getTotalWordsCnt(), thresholdDict.getTotalWordsCnt());
+  EXPECT_GT(noRescaleCtxDict.getTotalWordsCnt(),
+            thresholdDict.getTotalWordsCnt());
+}
+
 // NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
 // cert-err58-cpp)
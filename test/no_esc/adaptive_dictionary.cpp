@@ -79,5 +79,23 @@ TEST(AdaptiveDictionary, GetWordAfterUpdate) {
   EXPECT_EQ(dict.getWordOrd(43), 42);
 }
 
+TEST(AdaptiveDictionary, RescaleHalvesCounts) {
+  // Total starts from `maxOrd`, so it exceeds 10 on the 6th word 1.
+  auto dict = AdaptiveDictionary({4, 2, 10});
+  [[maybe_unused]] const auto stats2 = dict.getProbabilityStats(2);
+  for (std::size_t i = 0; i < 6; ++i) {
+    [[maybe_unused]] const auto stats1 = dict.getProbabilityStats(1);
+  }
+  // Word 1 count is halved from 6 to 3, word 2 count 1 is rounded up.
+  const auto [low1, high1, total1] = dict.getProbabilityStats(1);
+  EXPECT_EQ(low1, 1);
+  EXPECT_EQ(high1, 1 + 3 * 2 + 1);
+  EXPECT_EQ(total1, 4 + (4 + 3 + 1) * 2);
+  const auto [low2, high2, total2] = dict.getProbabilityStats(2);
+  EXPECT_EQ(low2, 2 + 4 * 2);
+  EXPECT_EQ(high2, low2 + 1 * 2 + 1);
+  EXPECT_EQ(total2, 4 + (4 + 4 + 1) * 2);
+}
+
 // NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
 // cert-err58-cpp)
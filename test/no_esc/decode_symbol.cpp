@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <ael/dictionary/adaptive_a_contextual_dictionary.hpp>
+#include <ael/dictionary/adaptive_a_contextual_dictionary_improved.hpp>
+#include <ael/dictionary/adaptive_a_dictionary.hpp>
+#include <ael/dictionary/adaptive_d_contextual_dictionary.hpp>
+#include <ael/dictionary/adaptive_d_dictionary.hpp>
+#include <ael/dictionary/narrow_adaptive_d_dictionary.hpp>
+#include <ael/dictionary/ppma_dictionary.hpp>
+#include <ael/dictionary/ppmd_dictionary.hpp>
+#include <ael/dictionary/sorted_adaptive_a_dictionary.hpp>
+#include <ael/dictionary/static_dictionary.hpp>
+#include <random>
+#include <type_traits>
+
+// NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
+
+namespace {
+
+template <class DictT>
+DictT makeDict() {
+  if constexpr (std::is_same_v<DictT, ael::dict::PPMADictionary> ||
+                std::is_same_v<DictT, ael::dict::PPMDDictionary>) {
+    return DictT({64, 3});
+  } else if constexpr (std::is_same_v<DictT, ael::dict::StaticDictionary>) {
+    return DictT(64, std::map<std::uint64_t, std::uint64_t>{
+                         {0, 3}, {5, 1}, {17, 10}, {40, 2}, {63, 7}});
+  } else if constexpr (std::is_constructible_v<DictT, std::uint64_t>) {
+    return DictT(64);
+  } else {
+    return DictT({6, 2, 3});
+  }
+}
+
+template <class DictT>
+class DecodeSymbolTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(DecodeSymbolTest);
+
+TYPED_TEST_P(DecodeSymbolTest, SameAsGetWordOrdAndGetProbabilityStats) {
+  auto gen = std::mt19937(42);
+  auto separateDict = makeDict<TypeParam>();
+  auto fusedDict = makeDict<TypeParam>();
+  for (std::size_t i = 0; i < 500; ++i) {
+    const auto total = separateDict.getTotalWordsCnt();
+    ASSERT_EQ(fusedDict.getTotalWordsCnt(), total);
+    const auto target = static_cast<typename TypeParam::Count>(gen()) %
+                        static_cast<typename TypeParam::Count>(total);
+
+    const auto ord = separateDict.getWordOrd(target);
+    const auto [low, high, separateTotal] =
+        separateDict.getProbabilityStats(ord);
+    const auto decoded = fusedDict.decodeSymbol(target);
+
+    EXPECT_EQ(decoded.ord, ord);
+    EXPECT_EQ(decoded.low, low);
+    EXPECT_EQ(decoded.high, high);
+    EXPECT_EQ(decoded.total, separateTotal);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(DecodeSymbolTest,
+                            SameAsGetWordOrdAndGetProbabilityStats);
+
+using Types = ::testing::Types<
+    ael::dict::AdaptiveADictionary, ael::dict::AdaptiveDDictionary,
+    ael::dict::NarrowAdaptiveDDictionary,
+    ael::dict::AdaptiveAContextualDictionary,
+    ael::dict::AdaptiveDContextualDictionary,
+    ael::dict::AdaptiveAContextualDictionaryImproved, ael::dict::PPMADictionary,
+    ael::dict::PPMDDictionary, ael::dict::StaticDictionary,
+    ael::dict::SortedAdaptiveADictionary>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Dictionaries, DecodeSymbolTest, Types);
+
+}  // namespace
+
+// NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <ael/dictionary/adaptive_a_dictionary.hpp>
+#include <ael/dictionary/adaptive_d_dictionary.hpp>
+#include <ael/dictionary/narrow_adaptive_a_dictionary.hpp>
+#include <ael/dictionary/narrow_adaptive_d_dictionary.hpp>
+#include <stdexcept>
+
+using ael::dict::NarrowAdaptiveADictionary;
+using ael::dict::NarrowAdaptiveDDictionary;
+
+// NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
+
+TEST(NarrowAdaptiveADictionary, Construct) {
+  auto dict = NarrowAdaptiveADictionary(256);
+}
+
+TEST(NarrowAdaptiveADictionary, TooBigAlphabet) {
+  EXPECT_THROW(NarrowAdaptiveADictionary(257), std::invalid_argument);
+}
+
+TEST(NarrowAdaptiveDDictionary, TooBigAlphabet) {
+  EXPECT_THROW(NarrowAdaptiveDDictionary(1000), std::invalid_argument);
+}
+
+TEST(NarrowAdaptiveADictionary, SameAsWideBeforeRescale) {
+  auto narrow = NarrowAdaptiveADictionary(8);
+  auto wide = ael::dict::AdaptiveADictionary(8);
+  for (const auto ord : {3, 5, 3, 0, 7, 3, 3, 1}) {
+    const auto [narrowLow, narrowHigh, narrowTotal] =
+        narrow.getProbabilityStats(ord);
+    const auto [wideLow, wideHigh, wideTotal] = wide.getProbabilityStats(ord);
+    EXPECT_EQ(narrowLow, wideLow);
+    EXPECT_EQ(narrowHigh, wideHigh);
+    EXPECT_EQ(narrowTotal, wideTotal);
+  }
+}
+
+TEST(NarrowAdaptiveDDictionary, SameAsWideBeforeRescale) {
+  auto narrow = NarrowAdaptiveDDictionary(8);
+  auto wide = ael::dict::AdaptiveDDictionary(8);
+  for (const auto ord : {3, 5, 3, 0, 7, 3, 3, 1}) {
+    const auto [narrowLow, narrowHigh, narrowTotal] =
+        narrow.getProbabilityStats(ord);
+    const auto [wideLow, wideHigh, wideTotal] = wide.getProbabilityStats(ord);
+    EXPECT_EQ(narrowLow, wideLow);
+    EXPECT_EQ(narrowHigh, wideHigh);
+    EXPECT_EQ(narrowTotal, wideTotal);
+  }
+}
+
+TEST(NarrowAdaptiveADictionary, TotalStaysInRange) {
+  auto dict = NarrowAdaptiveADictionary(256);
+  for (std::uint64_t i = 0; i < 100000; ++i) {
+    [[maybe_unused]] const auto _stats = dict.getProbabilityStats(i % 7);
+    EXPECT_LE(dict.getTotalWordsCnt(),
+              NarrowAdaptiveADictionary::maxTotalWordsCnt);
+  }
+}
+
+TEST(NarrowAdaptiveDDictionary, TotalStaysInRange) {
+  auto dict = NarrowAdaptiveDDictionary(256);
+  for (std::uint64_t i = 0; i < 100000; ++i) {
+    [[maybe_unused]] const auto _stats = dict.getProbabilityStats(i % 200);
+    EXPECT_LE(dict.getTotalWordsCnt(),
+              NarrowAdaptiveDDictionary::maxTotalWordsCnt);
+  }
+}
+
+TEST(NarrowAdaptiveADictionary, RescaleKeepsMetWords) {
+  auto dict = NarrowAdaptiveADictionary(256);
+  [[maybe_unused]] const auto _stats0 = dict.getProbabilityStats(42);
+  for (std::uint64_t i = 0; i < 10000; ++i) {
+    [[maybe_unused]] const auto _stats1 = dict.getProbabilityStats(7);
+  }
+  const auto [low7, high7, total7] = dict.getProbabilityStats(7);
+  const auto [low42, high42, total42] = dict.getProbabilityStats(42);
+  EXPECT_GT(high42 - low42, 1);  // Met word is more probable than new ones.
+  EXPECT_GT(high7 - low7, high42 - low42);
+}
+
+TEST(NarrowAdaptiveADictionary, GetWordOrdAfterRescale) {
+  auto dict = NarrowAdaptiveADictionary(256);
+  for (std::uint64_t i = 0; i < 10000; ++i) {
+    [[maybe_unused]] const auto _stats = dict.getProbabilityStats(i % 5 * 50);
+  }
+  for (std::uint64_t ord = 0; ord < 256; ++ord) {
+    auto copy = dict;
+    const auto [low, high, total] = copy.getProbabilityStats(ord);
+    EXPECT_EQ(dict.getWordOrd(low), ord);
+    EXPECT_EQ(dict.getWordOrd(high - 1), ord);
+  }
+}
+
+// NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <ael/dictionary/normalize_counts.hpp>
+#include <ael/dictionary/static_dictionary.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <stdexcept>
+
+using ael::dict::normalizeCounts;
+using ael::dict::StaticDictionary;
+
+// NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
+
+namespace {
+
+std::uint64_t sumCounts(const std::map<std::uint64_t, std::uint64_t>& counts) {
+  auto ret = std::uint64_t{0};
+  for (const auto& [ord, cnt] : counts) {
+    ret += cnt;
+  }
+  return ret;
+}
+
+}  // namespace
+
+TEST(NormalizeCounts, ExactProportions) {
+  const auto normalized = normalizeCounts({{0, 3}, {5, 1}, {9, 4}}, 4);
+  const auto expected =
+      std::map<std::uint64_t, std::uint64_t>{{0, 6}, {5, 2}, {9, 8}};
+  EXPECT_EQ(normalized, expected);
+}
+
+TEST(NormalizeCounts, RareWordsStayPresent) {
+  const auto normalized =
+      normalizeCounts({{0, 1000000}, {1, 1}, {2, 0}, {3, 2}}, 8);
+  EXPECT_EQ(sumCounts(normalized), 256);
+  EXPECT_EQ(normalized.at(1), 1);
+  EXPECT_EQ(normalized.at(3), 1);
+  EXPECT_EQ(normalized.at(0), 254);
+  EXPECT_FALSE(normalized.contains(2));
+}
+
+TEST(NormalizeCounts, RandomTotalIsPowerOfTwo) {
+  auto gen = std::mt19937(42);
+  for (const std::uint16_t totalLog2 : {6, 10, 12, 16}) {
+    auto counts = std::map<std::uint64_t, std::uint64_t>{};
+    for (std::uint64_t ord = 0; ord < 50; ++ord) {
+      counts[ord] = gen() % 3 == 0 ? 0 : gen() % 10000;
+    }
+    const auto normalized = normalizeCounts(counts, totalLog2);
+    EXPECT_EQ(sumCounts(normalized), std::uint64_t{1} << totalLog2);
+    for (const auto& [ord, cnt] : counts) {
+      EXPECT_EQ(normalized.contains(ord), cnt != 0);
+    }
+  }
+}
+
+TEST(NormalizeCounts, Throws) {
+  EXPECT_THROW(normalizeCounts({}, 4), std::invalid_argument);
+  EXPECT_THROW(normalizeCounts({{1, 0}}, 4), std::invalid_argument);
+  EXPECT_THROW(normalizeCounts({{0, 1}, {1, 1}, {2, 1}}, 1),
+               std::invalid_argument);
+}
+
+TEST(NormalizeCounts, ThrowsOnTooBigTotal) {
+  const auto counts = std::map<std::uint64_t, std::uint64_t>{{0, 3}, {1, 5}};
+  constexpr auto maxTotalLog2 = StaticDictionary::countNumBits;
+  EXPECT_NO_THROW(normalizeCounts(counts, maxTotalLog2));
+  EXPECT_THROW(normalizeCounts(counts, maxTotalLog2 + 1),
+               std::invalid_argument);
+  EXPECT_THROW(normalizeCounts(counts, 64), std::invalid_argument);
+  EXPECT_THROW(normalizeCounts(counts, 200), std::invalid_argument);
+}
+
+TEST(NormalizeCounts, LookupTableSameAsBinarySearch) {
+  auto gen = std::mt19937(42);
+  auto counts = std::map<std::uint64_t, std::uint64_t>{};
+  for (std::uint64_t ord = 0; ord < 300; ++ord) {
+    if (gen() % 4 != 0) {
+      counts[ord] = gen() % 1000 + 1;
+    }
+  }
+  const auto normalized = normalizeCounts(counts, 12);
+  const auto dict = StaticDictionary(300, normalized);
+  ASSERT_EQ(dict.getTotalWordsCnt(), 4096);
+  ASSERT_EQ(dict.getTotalWordsCntLog2(), 12);
+
+  auto lower = std::uint64_t{0};
+  for (std::uint64_t ord = 0; ord < 300; ++ord) {
+    const auto cnt = normalized.contains(ord) ? normalized.at(ord) : 0;
+    for (auto target = lower; target < lower + cnt; ++target) {
+      ASSERT_EQ(dict.getWordOrd(target), ord);
+      const auto decoded = dict.decodeSymbol(target);
+      EXPECT_EQ(decoded.ord, ord);
+      EXPECT_EQ(decoded.low, lower);
+      EXPECT_EQ(decoded.high, lower + cnt);
+    }
+    lower += cnt;
+  }
+}
+
+// NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
@@ -1,12 +1,69 @@
 #include <gtest/gtest.h>
 
 #include <ael/dictionary/ppma_dictionary.hpp>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <random>
 
 using ael::dict::PPMADictionary;
 
 // NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
 // cert-err58-cpp)
 
+namespace {
+
+class BoundedResource : public std::pmr::memory_resource {
+ public:
+  explicit BoundedResource(std::size_t maxBytes) : maxBytes_{maxBytes} {
+  }
+
+  [[nodiscard]] std::size_t getBytes() const {
+    return bytes_;
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    if (bytes_ + bytes > maxBytes_) {
+      throw std::bad_alloc();
+    }
+    auto* ret = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    bytes_ += bytes;
+    return ret;
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes,
+                     std::size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    bytes_ -= bytes;
+  }
+
+  [[nodiscard]] bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+  std::size_t bytes_{0};
+  const std::size_t maxBytes_;
+};
+
+class DefaultResourceGuard {
+ public:
+  explicit DefaultResourceGuard(std::pmr::memory_resource* resource)
+      : prev_{std::pmr::set_default_resource(resource)} {
+  }
+  DefaultResourceGuard(const DefaultResourceGuard&) = delete;
+  DefaultResourceGuard& operator=(const DefaultResourceGuard&) = delete;
+  ~DefaultResourceGuard() {
+    std::pmr::set_default_resource(prev_);
+  }
+
+ private:
+  std::pmr::memory_resource* prev_;
+};
+
+}  // namespace
+
 TEST(PPMADictionary, Construct) {
   const auto dict = PPMADictionary({256, 1});
 }
@@ -95,5 +152,23 @@ TEST(PPMADictionary, Example) {
   EXPECT_EQ(total7, 250 * 8);
 }
 
+TEST(PPMADictionary, RestartReturnsMemoryUpstream) {
+  auto upstream = BoundedResource(1 << 22);
+  {
+    const auto guard = DefaultResourceGuard(&upstream);
+    auto dict = PPMADictionary({256, 3, ael::impl::dict::noRescale, 1000});
+    auto gen = std::mt19937(42);
+    auto prevBytes = upstream.getBytes();
+    auto dropsCnt = 0;
+    for (auto i = 0; i < 20000; ++i) {
+      [[maybe_unused]] const auto stats = dict.getProbabilityStats(gen() % 256);
+      dropsCnt += (upstream.getBytes() < prevBytes / 2) ? 1 : 0;
+      prevBytes = upstream.getBytes();
+    }
+    EXPECT_GT(dropsCnt, 0);
+  }
+  EXPECT_EQ(upstream.getBytes(), 0);
+}
+
 // NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
 // cert-err58-cpp)
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <ael/arithmetic_coder.hpp>
+#include <ael/arithmetic_decoder.hpp>
+#include <ael/data_parser.hpp>
+#include <ael/dictionary/adaptive_a_dictionary.hpp>
+#include <ael/dictionary/adaptive_d_dictionary.hpp>
+#include <ael/dictionary/adaptive_dictionary.hpp>
+#include <ael/dictionary/small_adaptive_a_dictionary.hpp>
+#include <ael/dictionary/small_adaptive_d_dictionary.hpp>
+#include <ael/dictionary/small_adaptive_dictionary.hpp>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
+
+namespace {
+
+constexpr auto maxOrd = std::uint64_t{256};
+
+template <class SmallDictT, class DictT>
+void checkSameAsRuntimeDictionary(SmallDictT& smallDict, DictT& dict,
+                                  bool sameTotal = true,
+                                  std::uint64_t alphabetSize = maxOrd) {
+  auto gen = std::mt19937(42);
+  for (std::size_t i = 0; i < 3000; ++i) {
+    // Skewed sequence, so that some words are met often and some never.
+    const auto ord = std::uint64_t{gen() % 7 == 0 ? gen() % alphabetSize
+                                                  : gen() % 5 % alphabetSize};
+    const auto total = smallDict.getTotalWordsCnt();
+    if (sameTotal) {
+      ASSERT_EQ(dict.getTotalWordsCnt(), total);
+    }
+    const auto target = std::uint64_t{gen()} % total;
+    ASSERT_EQ(smallDict.getWordOrd(target), dict.getWordOrd(target));
+
+    const auto [low, high, wordTotal] = dict.getProbabilityStats(ord);
+    const auto [smallLow, smallHigh, smallTotal] =
+        smallDict.getProbabilityStats(ord);
+    ASSERT_EQ(smallLow, low);
+    ASSERT_EQ(smallHigh, high);
+    if (sameTotal) {
+      ASSERT_EQ(smallTotal, wordTotal);
+    }
+  }
+}
+
+TEST(SmallAdaptiveDictionary, SameAsAdaptiveADictionary) {
+  auto smallDict = ael::dict::SmallAdaptiveADictionary<maxOrd>();
+  auto dict = ael::dict::AdaptiveADictionary(maxOrd);
+  checkSameAsRuntimeDictionary(smallDict, dict);
+}
+
+TEST(SmallAdaptiveDictionary, SameAsAdaptiveDDictionary) {
+  auto smallDict = ael::dict::SmallAdaptiveDDictionary<maxOrd>();
+  auto dict = ael::dict::AdaptiveDDictionary(maxOrd);
+  checkSameAsRuntimeDictionary(smallDict, dict);
+}
+
+TEST(SmallAdaptiveDictionary, SameAsAdaptiveDictionary) {
+  auto smallDict = ael::dict::SmallAdaptiveDictionary<maxOrd>(7);
+  auto dict = ael::dict::AdaptiveDictionary({maxOrd, 7});
+  // AdaptiveDictionary total starts from `maxOrd` extra words, which no word
+  // gets. Here total is the sum of word counts.
+  checkSameAsRuntimeDictionary(smallDict, dict, false);
+  EXPECT_EQ(smallDict.getTotalWordsCnt(), maxOrd + 7 * 3000);
+}
+
+TEST(SmallAdaptiveDictionary, RescaleSameAsRuntimeDictionaries) {
+  constexpr auto threshold = std::uint64_t{100};
+  auto smallA = ael::dict::SmallAdaptiveADictionary<maxOrd>(threshold);
+  auto dictA = ael::dict::AdaptiveADictionary(
+      maxOrd, ael::impl::dict::CountsLayout::automatic, threshold);
+  checkSameAsRuntimeDictionary(smallA, dictA);
+  auto smallD = ael::dict::SmallAdaptiveDDictionary<maxOrd>(threshold);
+  auto dictD = ael::dict::AdaptiveDDictionary(
+      maxOrd, ael::impl::dict::CountsLayout::automatic, threshold);
+  checkSameAsRuntimeDictionary(smallD, dictD);
+  auto small = ael::dict::SmallAdaptiveDictionary<maxOrd>(7, threshold);
+  // AdaptiveDictionary threshold counts its `maxOrd` extra words too.
+  auto dict = ael::dict::AdaptiveDictionary({maxOrd, 7, threshold + maxOrd});
+  checkSameAsRuntimeDictionary(small, dict, false);
+}
+
+TEST(SmallAdaptiveDictionary, RescaleHalvesCounts) {
+  auto dict = ael::dict::SmallAdaptiveADictionary<4>(10);
+  [[maybe_unused]] const auto stats2 = dict.getProbabilityStats(2);
+  for (std::size_t i = 0; i < 10; ++i) {
+    [[maybe_unused]] const auto stats1 = dict.getProbabilityStats(1);
+  }
+  // Total 11 exceeds 10: word 1 count is halved from 10 to 5, word 2 count 1
+  // is rounded up. Lower counts are `2 * realLower + ord - uniqueLower`.
+  const auto [low, high, total] = dict.getProbabilityStats(2);
+  EXPECT_EQ(low, 2 * 5 + 2 - 1);
+  EXPECT_EQ(high, 2 * 6 + 3 - 2);
+  EXPECT_EQ(total, 2 * 6 + 4 - 2);
+}
+
+TEST(SmallAdaptiveDictionary, AlphabetNotFillingVectors) {
+  // Lower counts of 2, 6 and 8 words take parts of vectors.
+  auto smallA1 = ael::dict::SmallAdaptiveADictionary<1>();
+  auto dictA1 = ael::dict::AdaptiveADictionary(1);
+  checkSameAsRuntimeDictionary(smallA1, dictA1, true, 1);
+  auto smallD5 = ael::dict::SmallAdaptiveDDictionary<5>();
+  auto dictD5 = ael::dict::AdaptiveDDictionary(5);
+  checkSameAsRuntimeDictionary(smallD5, dictD5, true, 5);
+  auto smallA7 = ael::dict::SmallAdaptiveADictionary<7>();
+  auto dictA7 = ael::dict::AdaptiveADictionary(7);
+  checkSameAsRuntimeDictionary(smallA7, dictA7, true, 7);
+}
+
+TEST(SmallAdaptiveDictionary, AllWordsMet) {
+  auto smallDict = ael::dict::SmallAdaptiveADictionary<3>();
+  auto dict = ael::dict::AdaptiveADictionary(3);
+  for (const auto ord : {0, 1, 2, 2, 0, 2, 1}) {
+    const auto [low, high, total] = dict.getProbabilityStats(ord);
+    const auto [smallLow, smallHigh, smallTotal] =
+        smallDict.getProbabilityStats(ord);
+    EXPECT_EQ(smallLow, low);
+    EXPECT_EQ(smallHigh, high);
+    EXPECT_EQ(smallTotal, total);
+  }
+  for (const auto target : {0, 1, 2, 3, 4, 5, 6}) {
+    EXPECT_EQ(smallDict.getWordOrd(target), dict.getWordOrd(target));
+  }
+}
+
+TEST(SmallAdaptiveDictionary, DecodeSymbol) {
+  auto gen = std::mt19937(7);
+  auto separateDict = ael::dict::SmallAdaptiveDDictionary<17>();
+  auto fusedDict = ael::dict::SmallAdaptiveDDictionary<17>();
+  for (std::size_t i = 0; i < 500; ++i) {
+    const auto target = std::uint64_t{gen()} % fusedDict.getTotalWordsCnt();
+    const auto ord = separateDict.getWordOrd(target);
+    const auto [low, high, total] = separateDict.getProbabilityStats(ord);
+    const auto decoded = fusedDict.decodeSymbol(target);
+    EXPECT_EQ(decoded.ord, ord);
+    EXPECT_EQ(decoded.low, low);
+    EXPECT_EQ(decoded.high, high);
+    EXPECT_EQ(decoded.total, total);
+  }
+}
+
+TEST(SmallAdaptiveDictionary, EncodeDecode) {
+  auto gen = std::mt19937(13);
+  auto sequence = std::vector<std::uint64_t>(5000);
+  for (auto& ord : sequence) {
+    ord = gen() % 3 == 0 ? gen() % maxOrd : gen() % 16;
+  }
+
+  auto encodeDict = ael::dict::SmallAdaptiveADictionary<maxOrd>();
+  auto [dataConstructor, wordsCnt, bitsCnt] =
+      ael::ArithmeticCoder().encode(sequence, encodeDict).finalize();
+
+  auto decoded = std::vector<std::uint64_t>{};
+  auto decodeDict = ael::dict::SmallAdaptiveADictionary<maxOrd>();
+  auto dataParser = ael::DataParser(dataConstructor->getDataSpan());
+  ael::ArithmeticDecoder(dataParser, bitsCnt)
+      .decode(decodeDict, std::back_inserter(decoded), wordsCnt);
+
+  EXPECT_EQ(decoded, sequence);
+}
+
+}  // namespace
+
+// NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <ael/arithmetic_coder.hpp>
+#include <ael/arithmetic_decoder.hpp>
+#include <ael/data_parser.hpp>
+#include <ael/dictionary/adaptive_a_dictionary.hpp>
+#include <ael/dictionary/sorted_adaptive_a_dictionary.hpp>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <vector>
+
+using ael::dict::SortedAdaptiveADictionary;
+
+// NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
+
+TEST(SortedAdaptiveADictionary, FirstWord) {
+  auto dict = SortedAdaptiveADictionary(8);
+  const auto [low, high, total] = dict.getProbabilityStats(5);
+  EXPECT_EQ(low, 5);
+  EXPECT_EQ(high, 6);
+  EXPECT_EQ(total, 8);
+}
+
+TEST(SortedAdaptiveADictionary, FrequentWordGoesFirst) {
+  auto dict = SortedAdaptiveADictionary(8);
+  for (const auto ord : {3, 6, 6}) {
+    [[maybe_unused]] const auto stats = dict.getProbabilityStats(ord);
+  }
+  // Real counts: 6 -> 2, 3 -> 1. Model counts are scaled by 6 unmet words.
+  const auto [low6, high6, total6] = dict.getProbabilityStats(6);
+  EXPECT_EQ(low6, 0);
+  EXPECT_EQ(high6, 2 * 6);
+  EXPECT_EQ(total6, 6 * 4);
+  const auto [low3, high3, total3] = dict.getProbabilityStats(3);
+  EXPECT_EQ(low3, 3 * 6);
+  EXPECT_EQ(high3, 4 * 6);
+  EXPECT_EQ(total3, 6 * 5);
+  EXPECT_EQ(dict.getWordOrd(0), 6);
+  EXPECT_EQ(dict.getWordOrd(3 * 6 - 1), 6);
+  EXPECT_EQ(dict.getWordOrd(3 * 6), 3);
+}
+
+TEST(SortedAdaptiveADictionary, SameProbabilitiesAsAdaptiveADictionary) {
+  constexpr auto maxOrd = std::uint64_t{64};
+  auto gen = std::mt19937(42);
+  auto sortedDict = SortedAdaptiveADictionary(maxOrd);
+  auto dict = ael::dict::AdaptiveADictionary(maxOrd);
+  for (std::size_t i = 0; i < 3000; ++i) {
+    const auto ord = gen() % 5 == 0 ? gen() % maxOrd : gen() % 4;
+    const auto [low, high, total] = dict.getProbabilityStats(ord);
+    const auto [sortedLow, sortedHigh, sortedTotal] =
+        sortedDict.getProbabilityStats(ord);
+    ASSERT_EQ(sortedHigh - sortedLow, high - low);
+    ASSERT_EQ(sortedTotal, total);
+  }
+}
+
+TEST(SortedAdaptiveADictionary, SearchFindsWordsIntervals) {
+  constexpr auto maxOrd = std::uint64_t{20};
+  auto gen = std::mt19937(7);
+  auto dict = SortedAdaptiveADictionary(maxOrd, 100);
+  auto searchDict = SortedAdaptiveADictionary(maxOrd, 100);
+  for (std::size_t i = 0; i < 1000; ++i) {
+    const auto ord = gen() % 3 == 0 ? gen() % maxOrd : gen() % 3;
+    const auto [low, high, total] = dict.getProbabilityStats(ord);
+    ASSERT_EQ(searchDict.getWordOrd(low), ord);
+    ASSERT_EQ(searchDict.getWordOrd(high - 1), ord);
+    ASSERT_EQ(searchDict.getTotalWordsCnt(), total);
+    [[maybe_unused]] const auto stats = searchDict.getProbabilityStats(ord);
+  }
+}
+
+TEST(SortedAdaptiveADictionary, Rescale) {
+  auto dict = SortedAdaptiveADictionary(4, 6);
+  for (const auto ord : {2, 2, 2, 2, 2, 1, 1}) {
+    [[maybe_unused]] const auto stats = dict.getProbabilityStats(ord);
+  }
+  // Real counts {5, 2} are halved to {3, 1}.
+  const auto [low, high, total] = dict.getProbabilityStats(1);
+  EXPECT_EQ(low, 3 * 2);
+  EXPECT_EQ(high, 4 * 2);
+  EXPECT_EQ(total, 2 * 5);
+}
+
+TEST(SortedAdaptiveADictionary, EncodeDecode) {
+  auto gen = std::mt19937(13);
+  auto sequence = std::vector<std::uint64_t>(5000);
+  for (auto& ord : sequence) {
+    ord = gen() % 7 == 0 ? gen() % 256 : gen() % 3;
+  }
+
+  auto encodeDict = SortedAdaptiveADictionary(256, 1 << 10);
+  auto [dataConstructor, wordsCnt, bitsCnt] =
+      ael::ArithmeticCoder().encode(sequence, encodeDict).finalize();
+
+  auto decoded = std::vector<std::uint64_t>{};
+  auto decodeDict = SortedAdaptiveADictionary(256, 1 << 10);
+  auto dataParser = ael::DataParser(dataConstructor->getDataSpan());
+  ael::ArithmeticDecoder(dataParser, bitsCnt)
+      .decode(decodeDict, std::back_inserter(decoded), wordsCnt);
+
+  EXPECT_EQ(decoded, sequence);
+}
+
+// NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
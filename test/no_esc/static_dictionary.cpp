@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 
 #include <ael/dictionary/static_dictionary.hpp>
+#include <algorithm>
 #include <array>
 #include <cstdint>
+#include <random>
+#include <vector>
 
 using ael::dict::StaticDictionary;
 
@@ -91,5 +94,57 @@ TEST(StaticDictionary, CumulativeNumFoundHigh) {
   EXPECT_EQ(high2, 42);
 }
 
+TEST(StaticDictionary, TotalWordsCntLog2PowerOfTwo) {
+  const auto countMap = std::array{StaticDictionary::CountMapping{3, 5},
+                                   StaticDictionary::CountMapping{7, 11}};
+  const auto dict = StaticDictionary(16, countMap);
+  EXPECT_EQ(dict.getTotalWordsCntLog2(), 4);
+}
+
+TEST(StaticDictionary, TotalWordsCntLog2NotPowerOfTwo) {
+  const auto countMap = std::array{StaticDictionary::CountMapping{3, 5},
+                                   StaticDictionary::CountMapping{7, 10}};
+  const auto dict = StaticDictionary(16, countMap);
+  EXPECT_EQ(dict.getTotalWordsCntLog2(),
+            ael::impl::dict::unknownTotalWordsCntLog2);
+}
+
+TEST(StaticDictionary, DecodeIndexSameAsBinarySearch) {
+  auto gen = std::mt19937(42);
+  for (const auto maxOrd : {std::uint64_t{64}, std::uint64_t{300},
+                            std::uint64_t{1} << 12}) {
+    for (const auto maxCnt : {std::uint64_t{1}, std::uint64_t{7},
+                              std::uint64_t{1} << 30}) {
+      auto counts = std::vector<StaticDictionary::CountMapping>{};
+      for (std::uint64_t ord = 0; ord < maxOrd; ++ord) {
+        // Some words have zero counts.
+        if (gen() % 4 != 0) {
+          counts.push_back({ord, 1 + std::uint64_t{gen()} % maxCnt});
+        }
+      }
+      auto dict = StaticDictionary(maxOrd, counts);
+      auto cumulative = std::vector<std::uint64_t>{};
+      auto total = std::uint64_t{0};
+      auto countIt = counts.begin();
+      for (std::uint64_t ord = 0; ord < maxOrd; ++ord) {
+        if (countIt != counts.end() && countIt->ord == ord) {
+          total += countIt->count;
+          ++countIt;
+        }
+        cumulative.push_back(total);
+      }
+      for (std::size_t i = 0; i < 2000; ++i) {
+        const auto target = std::uint64_t{gen()} * gen() % total;
+        const auto expected = static_cast<std::uint64_t>(
+            std::ranges::upper_bound(cumulative, target) - cumulative.begin());
+        ASSERT_EQ(dict.getWordOrd(target), expected);
+        ASSERT_EQ(dict.decodeSymbol(target).ord, expected);
+      }
+      ASSERT_EQ(dict.getWordOrd(0), counts.front().ord);
+      ASSERT_EQ(dict.getWordOrd(total - 1), counts.back().ord);
+    }
+  }
+}
+
 // NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
 // cert-err58-cpp)
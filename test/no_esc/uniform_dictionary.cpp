@@ -56,5 +56,16 @@ TEST(UniformDictionary, TotalWordsCount) {
   EXPECT_EQ(total, 256);
 }
 
+TEST(UniformDictionary, TotalWordsCntLog2PowerOfTwo) {
+  const auto dict = UniformDictionary(256);
+  EXPECT_EQ(dict.getTotalWordsCntLog2(), 8);
+}
+
+TEST(UniformDictionary, TotalWordsCntLog2NotPowerOfTwo) {
+  const auto dict = UniformDictionary(255);
+  EXPECT_EQ(dict.getTotalWordsCntLog2(),
+            ael::impl::dict::unknownTotalWordsCntLog2);
+}
+
 // NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
 // cert-err58-cpp)
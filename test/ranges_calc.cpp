@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <ael/impl/ranges_calc.hpp>
+#include <cstdint>
+#include <random>
+
+// NOLINTBEGIN(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)
+
+namespace {
+
+using RC = ael::impl::RangesCalc<std::uint64_t, 62>;
+using NarrowRC = ael::impl::RangesCalc<std::uint32_t, 31>;
+
+struct Renormalized {
+  RC::Range rng;
+  std::uint16_t settled;
+  std::uint16_t follow;
+};
+
+Renormalized renormalizeBitByBit(RC::Range rng) {
+  auto ret = Renormalized{rng, 0, 0};
+  while (true) {
+    if (ret.rng.high <= RC::half || ret.rng.low >= RC::half) {
+      EXPECT_EQ(ret.follow, 0);
+      ++ret.settled;
+    } else if (ret.rng.low >= RC::quarter &&
+               ret.rng.high <= RC::threeQuarters) {
+      ++ret.follow;
+    } else {
+      return ret;
+    }
+    ret.rng = RC::recalcRange(ret.rng);
+  }
+}
+
+}  // namespace
+
+TEST(RangesCalc, SettledBitsOfFullRange) {
+  EXPECT_EQ(RC::countSettledBits({0, RC::total}), 0);
+}
+
+TEST(RangesCalc, SettledBitsOfSmallRange) {
+  EXPECT_EQ(RC::countSettledBits({RC::half, RC::half + 2}), 61);
+}
+
+TEST(RangesCalc, FollowBits) {
+  const auto rng = RC::Range{RC::half - 8, RC::half + 8};
+  EXPECT_EQ(RC::countFollowBits(rng), 58);
+}
+
+TEST(RangesCalc, BulkRenormalizationMatchesBitByBit) {
+  auto gen = std::mt19937_64(42);
+  auto distr = std::uniform_int_distribution<std::uint64_t>(0, RC::total - 1);
+  for (std::size_t i = 0; i < 10000; ++i) {
+    auto low = distr(gen);
+    auto high = distr(gen);
+    if (low > high) {
+      std::swap(low, high);
+    }
+    // Narrow some ranges to get long settled and follow runs.
+    const auto len = (high - low) >> (i % 60);
+    const auto rng = RC::Range{low, low + len + 1};
+
+    const auto expected = renormalizeBitByBit(rng);
+    const auto settled = RC::countSettledBits(rng);
+    const auto afterSettled = RC::shiftSettled(rng, settled);
+    const auto follow = RC::countFollowBits(afterSettled);
+    const auto result = RC::shiftFollow(afterSettled, follow);
+
+    EXPECT_EQ(settled, expected.settled);
+    EXPECT_EQ(follow, expected.follow);
+    EXPECT_EQ(result.low, expected.rng.low);
+    EXPECT_EQ(result.high, expected.rng.high);
+  }
+}
+
+TEST(RangesCalc, NarrowRangeMatchesWide) {
+  auto gen = std::mt19937(42);
+  auto distr = std::uniform_int_distribution<std::uint32_t>(0, 1 << 16);
+  for (std::size_t i = 0; i < 10000; ++i) {
+    const auto total = distr(gen) + 1;
+    auto low = distr(gen) % total;
+    auto high = distr(gen) % total + 1;
+    if (low >= high) {
+      std::swap(low, high);
+      ++high;
+    }
+    const auto rng = NarrowRC::Range{NarrowRC::quarter, NarrowRC::total - 7};
+    const auto narrow =
+        NarrowRC::rangeFromStatsAndPrev(rng, {low, high, total});
+    const auto wide = RC::rangeFromStatsAndPrev(
+        {rng.low, rng.high}, {low, high, std::uint64_t{total}});
+    EXPECT_EQ(narrow.low, wide.low);
+    EXPECT_EQ(narrow.high, wide.high);
+    EXPECT_LT(narrow.low, narrow.high);
+  }
+}
+
+// NOLINTEND(cppcoreguidelines-*, cert-*, readability-magic-numbers,
+// cert-err58-cpp)